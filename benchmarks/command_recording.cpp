@@ -0,0 +1,261 @@
+/*
+Command Recording Benchmark
+Records N Draws Per Frame Inline On The Main Thread, Then Split Across Command Lists On 1 / 2 / 4 / 8 Worker Threads
+Reports The CPU Time From The Start Of Recording To The End Of ExecuteCommandLists, Waiting On The GPU Is Excluded
+*/
+
+#include <gfx.h>
+#include <GLFW/glfw3.h>
+
+#include "worker_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+static const int WIDTH = 1280;
+static const int HEIGHT = 720;
+
+static const uint32_t WARMUP_FRAMES = 16;
+static const uint32_t MEASURED_FRAMES = 64;
+
+static const char* VERTEX_SHADER = R"(
+#version 450
+
+layout(push_constant) uniform DrawConstants
+{
+    vec4 offsetScale;
+    vec4 color;
+} draw;
+
+layout(location = 0) out vec4 outColor;
+
+void main()
+{
+    const vec2 positions[3] = vec2[](vec2(0.0, -1.0), vec2(1.0, 1.0), vec2(-1.0, 1.0));
+    gl_Position = vec4(draw.offsetScale.xy + positions[gl_VertexIndex] * draw.offsetScale.zw, 0.0, 1.0);
+    outColor = draw.color;
+}
+)";
+
+static const char* FRAGMENT_SHADER = R"(
+#version 450
+
+layout(location = 0) in vec4 inColor;
+layout(location = 0) out vec4 outColor;
+
+void main()
+{
+    outColor = inColor;
+}
+)";
+
+struct DrawConstants
+{
+    float offsetScale[4];
+    float color[4];
+};
+
+static GFX::RenderPass s_renderPass;
+static GFX::Pipeline s_pipeline;
+static std::vector<DrawConstants> s_draws;
+
+static void RecordDraws(uint32_t begin, uint32_t end)
+{
+    GFX::ApplyPipeline(s_pipeline);
+    GFX::SetViewport(0, 0, WIDTH, HEIGHT);
+    GFX::SetScissor(0, 0, WIDTH, HEIGHT);
+
+    for (uint32_t i = begin; i < end; i++)
+    {
+        GFX::PushConstants(GFX::ShaderStage::Vertex, 0, sizeof(DrawConstants), &s_draws[i]);
+        GFX::Draw(3, 1, 0, 0);
+    }
+}
+
+/*
+Returns The Average Recording Time In Milliseconds, threadCount 0 Records Inline
+*/
+static double MeasureRecording(GLFWwindow* window, uint32_t drawCount, uint32_t threadCount)
+{
+    WorkerPool* workers = threadCount > 0 ? new WorkerPool(threadCount) : nullptr;
+    std::vector<GFX::CommandList> commandLists(threadCount);
+
+    double totalMilliseconds = 0.0;
+    uint32_t frame = 0;
+    while (frame < WARMUP_FRAMES + MEASURED_FRAMES && !glfwWindowShouldClose(window))
+    {
+        glfwPollEvents();
+
+        if (!GFX::BeginFrame())
+        {
+            continue;
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        if (workers)
+        {
+            GFX::BeginRenderPass(s_renderPass, 0, 0, WIDTH, HEIGHT, GFX::SubpassContents::SecondaryCommandBuffers);
+
+            workers->Start([&](uint32_t workerIndex)
+            {
+                uint32_t begin = drawCount * workerIndex / threadCount;
+                uint32_t end = drawCount * (workerIndex + 1) / threadCount;
+
+                commandLists[workerIndex] = GFX::BeginCommandList(s_renderPass, 0);
+                RecordDraws(begin, end);
+                GFX::EndCommandList(commandLists[workerIndex]);
+            });
+            workers->Wait();
+
+            GFX::ExecuteCommandLists(commandLists);
+        }
+        else
+        {
+            GFX::BeginRenderPass(s_renderPass, 0, 0, WIDTH, HEIGHT);
+            RecordDraws(0, drawCount);
+        }
+
+        GFX::EndRenderPass();
+
+        auto end = std::chrono::high_resolution_clock::now();
+
+        GFX::EndFrame();
+
+        if (frame >= WARMUP_FRAMES)
+        {
+            totalMilliseconds += std::chrono::duration<double, std::milli>(end - start).count();
+        }
+        frame++;
+    }
+
+    delete workers;
+
+    return frame > WARMUP_FRAMES ? totalMilliseconds / (frame - WARMUP_FRAMES) : 0.0;
+}
+
+static void CreateResources()
+{
+    GFX::RenderPassDescription renderPassDescription = {};
+    renderPassDescription.width = WIDTH;
+    renderPassDescription.height = HEIGHT;
+
+    GFX::AttachmentDescription swapChainAttachment = {};
+    swapChainAttachment.format = GFX::Format::SWAPCHAIN;
+    swapChainAttachment.width = WIDTH;
+    swapChainAttachment.height = HEIGHT;
+    swapChainAttachment.type = GFX::AttachmentType::Present;
+    swapChainAttachment.loadAction = GFX::AttachmentLoadAction::Clear;
+    swapChainAttachment.storeAction = GFX::AttachmentStoreAction::Store;
+    renderPassDescription.attachments.push_back(swapChainAttachment);
+
+    GFX::SubPassDescription subPass = {};
+    subPass.pipelineType = GFX::PipelineType::Graphics;
+    subPass.colorAttachments.push_back(0);
+    renderPassDescription.subpasses.push_back(subPass);
+
+    s_renderPass = GFX::CreateRenderPass(renderPassDescription);
+
+    GFX::ShaderDescription vertDesc = {};
+    vertDesc.name = "command_recording.vert";
+    vertDesc.codes = VERTEX_SHADER;
+    vertDesc.stage = GFX::ShaderStage::Vertex;
+
+    GFX::ShaderDescription fragDesc = {};
+    fragDesc.name = "command_recording.frag";
+    fragDesc.codes = FRAGMENT_SHADER;
+    fragDesc.stage = GFX::ShaderStage::Fragment;
+
+    GFX::Shader vertShader = GFX::CreateShader(vertDesc);
+    GFX::Shader fragShader = GFX::CreateShader(fragDesc);
+
+    GFX::PushConstantRange pushConstantRange = {};
+    pushConstantRange.stage = GFX::ShaderStage::Vertex;
+    pushConstantRange.size = sizeof(DrawConstants);
+
+    GFX::GraphicsPipelineDescription pipelineDesc = {};
+    pipelineDesc.primitiveTopology = GFX::PrimitiveTopology::TriangleList;
+    pipelineDesc.shaders.push_back(vertShader);
+    pipelineDesc.shaders.push_back(fragShader);
+    pipelineDesc.renderPass = s_renderPass;
+    pipelineDesc.subpass = 0;
+    pipelineDesc.cullFace = GFX::CullFace::None;
+    pipelineDesc.blendStates.push_back({});
+    pipelineDesc.pushConstantRanges.push_back(pushConstantRange);
+
+    s_pipeline = GFX::CreatePipeline(pipelineDesc);
+
+    GFX::DestroyShader(vertShader);
+    GFX::DestroyShader(fragShader);
+}
+
+int main()
+{
+    glfwInit();
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+    glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
+    GLFWwindow* window = glfwCreateWindow(WIDTH, HEIGHT, "mo-gfx command recording benchmark", nullptr, nullptr);
+
+    GFX::InitialDescription initDesc = {};
+    initDesc.window = window;
+    GFX::Init(initDesc);
+
+    CreateResources();
+
+    const uint32_t drawCounts[] = { 10000, 20000, 50000 };
+    const uint32_t threadCounts[] = { 1, 2, 4, 8 };
+    uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    // Tiny Triangles Spread Over The Screen, The GPU Side Stays Cheap
+    uint32_t maxDraws = drawCounts[sizeof(drawCounts) / sizeof(drawCounts[0]) - 1];
+    s_draws.resize(maxDraws);
+    for (uint32_t i = 0; i < maxDraws; i++)
+    {
+        DrawConstants& draw = s_draws[i];
+        draw.offsetScale[0] = (i % 250) / 125.0f - 1.0f;
+        draw.offsetScale[1] = (i / 250 % 200) / 100.0f - 1.0f;
+        draw.offsetScale[2] = 0.004f;
+        draw.offsetScale[3] = 0.005f;
+        draw.color[0] = (i % 7) / 6.0f;
+        draw.color[1] = (i % 11) / 10.0f;
+        draw.color[2] = (i % 13) / 12.0f;
+        draw.color[3] = 1.0f;
+    }
+
+    printf("%u warmup frames, %u measured frames, %u hardware threads\n", WARMUP_FRAMES, MEASURED_FRAMES, hardwareThreads);
+    printf("%8s %8s %12s %12s %10s\n", "draws", "threads", "ms / frame", "ns / draw", "speedup");
+
+    for (auto drawCount : drawCounts)
+    {
+        double inlineMilliseconds = MeasureRecording(window, drawCount, 0);
+        printf("%8u %8s %12.3f %12.1f %10s\n", drawCount, "inline", inlineMilliseconds, inlineMilliseconds * 1e6 / drawCount, "1.00x");
+
+        for (auto threadCount : threadCounts)
+        {
+            if (threadCount > hardwareThreads)
+            {
+                continue;
+            }
+
+            double milliseconds = MeasureRecording(window, drawCount, threadCount);
+            double speedup = milliseconds > 0.0 ? inlineMilliseconds / milliseconds : 0.0;
+            printf("%8u %8u %12.3f %12.1f %9.2fx\n", drawCount, threadCount, milliseconds, milliseconds * 1e6 / drawCount, speedup);
+        }
+
+        GFX::RenderStatistics statistics = GFX::GetRenderStatistics();
+        printf("%8s last frame: %u draw calls, %u command lists\n", "", statistics.drawCalls, statistics.commandListsExecuted);
+    }
+
+    GFX::DestroyPipeline(s_pipeline);
+    GFX::DestroyRenderPass(s_renderPass);
+
+    GFX::Shutdown();
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+Frustum Culling Benchmark
+Culls 1M Boxes Against A Perspective Frustum With Culling::CullBoxes (AVX / SSE) And Culling::CullBoxesScalar
+Reports ms Per Cull And Checks Both Return The Same Visible Set
+*/
+
+#include "culling.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <vector>
+
+static const uint32_t BOX_COUNT = 1000000;
+static const uint32_t REPEATS = 20;
+
+typedef std::chrono::high_resolution_clock Clock;
+
+/*
+Best Of REPEATS In Milliseconds, visible Holds The Result Of The Last Run
+*/
+template<typename Cull>
+static double Measure(Cull cull, std::vector<uint32_t>& visible)
+{
+    double best = 0.0;
+    for (uint32_t i = 0; i < REPEATS; i++)
+    {
+        visible.clear();
+
+        auto start = Clock::now();
+        cull(visible);
+        auto end = Clock::now();
+
+        double milliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+        best = i == 0 ? milliseconds : std::min(best, milliseconds);
+    }
+
+    return best;
+}
+
+int main()
+{
+    // Small Boxes Scattered Around The Camera, About A Fifth Ends Up Visible
+    std::mt19937 random(1);
+    std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> extent(0.1f, 4.0f);
+
+    Culling::BoundsSoA bounds;
+    for (uint32_t i = 0; i < BOX_COUNT; i++)
+    {
+        glm::vec3 center = glm::vec3(position(random), position(random), position(random));
+        glm::vec3 halfSize = glm::vec3(extent(random), extent(random), extent(random));
+        bounds.Add(center - halfSize, center + halfSize);
+    }
+
+    glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.2f, 0.5f), glm::vec3(0.0f, 1.0f, 0.0f));
+    glm::mat4 projection = glm::perspective(glm::radians(90.0f), 16.0f / 9.0f, 0.1f, 600.0f);
+    Culling::Frustum frustum = Culling::Frustum::FromViewProjection(projection * view);
+
+    std::vector<uint32_t> scalarVisible;
+    std::vector<uint32_t> simdVisible;
+    scalarVisible.reserve(BOX_COUNT);
+    simdVisible.reserve(BOX_COUNT);
+
+    double scalarMilliseconds = Measure([&](std::vector<uint32_t>& visible) { Culling::CullBoxesScalar(bounds, frustum, 0, visible); }, scalarVisible);
+    double simdMilliseconds = Measure([&](std::vector<uint32_t>& visible) { Culling::CullBoxes(bounds, frustum, visible); }, simdVisible);
+
+#if defined(__AVX__)
+    const char* simdName = "CullBoxes (AVX)";
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    const char* simdName = "CullBoxes (SSE)";
+#else
+    const char* simdName = "CullBoxes (scalar)";
+#endif
+
+    printf("%u boxes, %zu visible, best of %u\n", BOX_COUNT, scalarVisible.size(), REPEATS);
+    printf("%20s %10s %14s\n", "path", "ms", "Mboxes / s");
+    printf("%20s %10.3f %14.1f\n", "CullBoxesScalar", scalarMilliseconds, BOX_COUNT / scalarMilliseconds / 1000.0);
+    printf("%20s %10.3f %14.1f\n", simdName, simdMilliseconds, BOX_COUNT / simdMilliseconds / 1000.0);
+    printf("%20s %9.2fx\n", "speedup", scalarMilliseconds / simdMilliseconds);
+
+    if (scalarVisible != simdVisible)
+    {
+        printf("Mismatch, scalar found %zu boxes, SIMD %zu\n", scalarVisible.size(), simdVisible.size());
+        return 1;
+    }
+
+    return 0;
+}
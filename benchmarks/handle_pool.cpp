@@ -0,0 +1,245 @@
+/*
+Handle Pool Benchmark
+Compares GFX::HandlePool Against The Previous Pool (Heap Allocated Resources, std::list Free List)
+With 100k Live Handles: Allocate, Fetch In Random Order, Free + Allocate Churn And Free
+*/
+
+#include <gfx.h>
+
+#include <algorithm>
+#include <chrono>
+#include <list>
+#include <random>
+#include <stdio.h>
+#include <vector>
+
+static const uint32_t LIVE_HANDLES = 100000;
+static const uint32_t FETCH_PASSES = 50;
+static const uint32_t CHURN_OPERATIONS = 1000000;
+static const uint32_t REPEATS = 5;
+
+/*
+Roughly The Size Of A Small Resource Such As BufferResource
+*/
+struct Resource
+{
+    Resource(uint64_t value)
+    {
+        for (auto& word : words)
+        {
+            word = value;
+        }
+    }
+
+    uint64_t words[8];
+};
+
+/*
+The Pool Before Generational Handles, Kept Here As The Baseline
+*/
+template<typename T>
+class LegacyHandlePool
+{
+public:
+    LegacyHandlePool(size_t reservedSize = 200)
+    {
+        m_handles.reserve(reservedSize);
+        m_resources.reserve(reservedSize);
+    }
+
+    uint32_t AllocateHandle(T* resource)
+    {
+        if (m_avaliableHandleList.size() != 0)
+        {
+            uint32_t result = m_avaliableHandleList.back();
+            m_avaliableHandleList.pop_back();
+
+            m_handles[result] = result;
+
+            m_resources[result] = resource;
+
+            return result;
+        }
+        else
+        {
+            uint32_t result = m_handles.size();
+            m_handles.push_back(result);
+            m_resources.push_back(resource);
+
+            return result;
+        }
+    }
+
+    void FreeHandle(uint32_t handle)
+    {
+        m_avaliableHandleList.push_back(handle);
+        delete m_resources[handle];
+        m_resources[handle] = nullptr;
+    }
+
+    T* FetchResource(uint32_t handle)
+    {
+        return m_resources[handle];
+    }
+
+private:
+    std::vector<uint32_t> m_handles;
+    std::vector<T*> m_resources;
+    std::list<uint32_t> m_avaliableHandleList;
+};
+
+/*
+Gives Both Pools The Same Interface
+*/
+struct GenerationalPool
+{
+    static const char* Name() { return "HandlePool"; }
+
+    uint32_t Allocate(uint64_t value) { return pool.Allocate(value); }
+    void Free(uint32_t handle) { pool.FreeHandle(handle); }
+    Resource* Fetch(uint32_t handle) { return pool.FetchResource(handle); }
+
+    GFX::HandlePool<Resource> pool;
+};
+
+struct LegacyPool
+{
+    static const char* Name() { return "legacy"; }
+
+    uint32_t Allocate(uint64_t value) { return pool.AllocateHandle(new Resource(value)); }
+    void Free(uint32_t handle) { pool.FreeHandle(handle); }
+    Resource* Fetch(uint32_t handle) { return pool.FetchResource(handle); }
+
+    LegacyHandlePool<Resource> pool;
+};
+
+struct Timings
+{
+    double allocate = 0.0;
+    double fetch = 0.0;
+    double churn = 0.0;
+    double free = 0.0;
+};
+
+typedef std::chrono::high_resolution_clock Clock;
+
+static double NanosecondsPerOperation(Clock::time_point start, Clock::time_point end, double operations)
+{
+    return std::chrono::duration<double, std::nano>(end - start).count() / operations;
+}
+
+// Keeps The Fetched Values Alive So The Loops Are Not Optimized Away
+static volatile uint64_t s_sink = 0;
+
+template<typename Pool>
+static Timings Run(uint32_t seed)
+{
+    Timings timings;
+    std::mt19937 random(seed);
+
+    Pool* pool = new Pool();
+    std::vector<uint32_t> handles(LIVE_HANDLES);
+
+    auto start = Clock::now();
+    for (uint32_t i = 0; i < LIVE_HANDLES; i++)
+    {
+        handles[i] = pool->Allocate(i);
+    }
+    auto end = Clock::now();
+    timings.allocate = NanosecondsPerOperation(start, end, LIVE_HANDLES);
+
+    // Punch Holes And Refill Them So Slots And Resources Are Not In Allocation Order
+    std::shuffle(handles.begin(), handles.end(), random);
+    for (uint32_t i = 0; i < LIVE_HANDLES / 2; i++)
+    {
+        pool->Free(handles[i]);
+    }
+    for (uint32_t i = 0; i < LIVE_HANDLES / 2; i++)
+    {
+        handles[i] = pool->Allocate(i);
+    }
+    std::shuffle(handles.begin(), handles.end(), random);
+
+    uint64_t sum = 0;
+    start = Clock::now();
+    for (uint32_t pass = 0; pass < FETCH_PASSES; pass++)
+    {
+        for (auto handle : handles)
+        {
+            sum += pool->Fetch(handle)->words[pass & 7];
+        }
+    }
+    end = Clock::now();
+    timings.fetch = NanosecondsPerOperation(start, end, double(FETCH_PASSES) * LIVE_HANDLES);
+
+    std::uniform_int_distribution<uint32_t> pick(0, LIVE_HANDLES - 1);
+    std::vector<uint32_t> victims(CHURN_OPERATIONS);
+    for (auto& victim : victims)
+    {
+        victim = pick(random);
+    }
+
+    start = Clock::now();
+    for (uint32_t i = 0; i < CHURN_OPERATIONS; i++)
+    {
+        uint32_t& handle = handles[victims[i]];
+        pool->Free(handle);
+        handle = pool->Allocate(i);
+        sum += handle;
+    }
+    end = Clock::now();
+    timings.churn = NanosecondsPerOperation(start, end, CHURN_OPERATIONS);
+
+    start = Clock::now();
+    for (auto handle : handles)
+    {
+        pool->Free(handle);
+    }
+    end = Clock::now();
+    timings.free = NanosecondsPerOperation(start, end, LIVE_HANDLES);
+
+    s_sink = s_sink + sum;
+    delete pool;
+
+    return timings;
+}
+
+/*
+Best Of REPEATS, Each Repeat Starts From An Empty Pool
+*/
+template<typename Pool>
+static Timings Measure()
+{
+    Timings best = Run<Pool>(1);
+    for (uint32_t i = 1; i < REPEATS; i++)
+    {
+        Timings timings = Run<Pool>(i + 1);
+        best.allocate = std::min(best.allocate, timings.allocate);
+        best.fetch = std::min(best.fetch, timings.fetch);
+        best.churn = std::min(best.churn, timings.churn);
+        best.free = std::min(best.free, timings.free);
+    }
+
+    printf("%12s %12.2f %12.2f %12.2f %12.2f\n", Pool::Name(), best.allocate, best.fetch, best.churn, best.free);
+    return best;
+}
+
+int main()
+{
+#ifndef NDEBUG
+    printf("Debug build, HandlePool validates every handle, use a release build for representative numbers\n");
+#endif
+    printf("%u live handles of %u bytes, ns per operation, best of %u\n", LIVE_HANDLES, uint32_t(sizeof(Resource)), REPEATS);
+    printf("%12s %12s %12s %12s %12s\n", "pool", "allocate", "fetch", "free+alloc", "free");
+
+    Timings legacy = Measure<LegacyPool>();
+    Timings generational = Measure<GenerationalPool>();
+
+    printf("%12s %11.2fx %11.2fx %11.2fx %11.2fx\n", "speedup",
+        legacy.allocate / generational.allocate,
+        legacy.fetch / generational.fetch,
+        legacy.churn / generational.churn,
+        legacy.free / generational.free);
+
+    return 0;
+}
@@ -3,7 +3,8 @@
 #include <string>
 #include <vector>
 #include <memory>
-#include <list>
+#include <new>
+#include <utility>
 #include <cassert>
 
 #include "ktx.h"
@@ -13,60 +14,142 @@ struct GLFWwindow;
 
 namespace GFX
 {
+    /*
+    Generational Handle Pool
+    Handle Layout: | generation (12 bits) | slot index (20 bits) |
+    Resources live in fixed size slab blocks, so pointers stay stable while the pool grows.
+    Generation starts from 1, so a default constructed handle (id = 0) is never valid.
+    */
     template<typename T>
     class HandlePool
     {
     public:
+        static const uint32_t INDEX_BITS = 20;
+        static const uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+        static const uint32_t GENERATION_MASK = (1u << (32 - INDEX_BITS)) - 1;
+        static const uint32_t BLOCK_BITS = 8;
+        static const uint32_t BLOCK_SIZE = 1u << BLOCK_BITS;
+
         HandlePool(size_t reservedSize = 200)
         {
-            m_handles.reserve(reservedSize);
-            m_resources.reserve(reservedSize);
+            m_slots.reserve(reservedSize);
+            m_blocks.reserve(reservedSize / BLOCK_SIZE + 1);
         }
 
-        uint32_t AllocateHandle(T* resource)
+        HandlePool(const HandlePool&) = delete;
+        HandlePool& operator=(const HandlePool&) = delete;
+
+        /*
+        Live resources are not destructed here, their GPU objects are owned by the device, which is gone at static destruction time
+        */
+        ~HandlePool()
         {
-            if (m_avaliableHandleList.size() != 0)
+            for (auto block : m_blocks)
             {
-                uint32_t result = m_avaliableHandleList.back();
-                m_avaliableHandleList.pop_back();
+                ::operator delete(block);
+            }
+        }
 
-                m_handles[result] = result;
+        template<typename... Args>
+        uint32_t Allocate(Args&&... args)
+        {
+            uint32_t index = AcquireSlot();
+            new (SlotPointer(index)) T(std::forward<Args>(args)...);
+            m_slots[index].nextFree = SLOT_ALIVE;
 
-                m_resources[result] = resource;
+            return (m_slots[index].generation << INDEX_BITS) | index;
+        }
 
-                return result;
-            }
-            else
+        void FreeHandle(uint32_t handle)
+        {
+            // Destroying a null handle is a no-op
+            if (handle == 0)
             {
-                uint32_t result = m_handles.size();
-                m_handles.push_back(result);
-                m_resources.push_back(resource);
+                return;
+            }
 
-                return result;
+            assert(IsValid(handle) && "HandlePool: double free or stale handle");
+
+            uint32_t index = handle & INDEX_MASK;
+            SlotPointer(index)->~T();
+
+            Slot& slot = m_slots[index];
+            slot.generation = (slot.generation + 1) & GENERATION_MASK;
+            if (slot.generation == 0)
+            {
+                slot.generation = 1;
             }
+            slot.nextFree = m_freeHead;
+            m_freeHead = index;
         }
 
-        void FreeHandle(uint32_t handle)
+        T* FetchResource(uint32_t handle)
         {
-            m_avaliableHandleList.push_back(handle);
-            delete m_resources[handle];
-            m_resources[handle] = nullptr;
+            assert(IsValid(handle) && "HandlePool: use of destroyed or invalid handle");
+            return SlotPointer(handle & INDEX_MASK);
         }
 
-        T* FetchResource(uint32_t handle)
+        bool IsValid(uint32_t handle) const
         {
-            return m_resources[handle];
+            uint32_t index = handle & INDEX_MASK;
+            if (handle == 0 || index >= m_slots.size())
+            {
+                return false;
+            }
+
+            const Slot& slot = m_slots[index];
+            return slot.nextFree == SLOT_ALIVE && slot.generation == (handle >> INDEX_BITS);
         }
 
     private:
-        std::vector<uint32_t> m_handles;
-        std::vector<T*> m_resources;
-        std::list<uint32_t> m_avaliableHandleList;
+        static const uint32_t SLOT_NONE = ~0u;
+        static const uint32_t SLOT_ALIVE = ~0u - 1;
+
+        struct Slot
+        {
+            uint32_t generation = 1;
+            // Intrusive free list link, SLOT_ALIVE while the slot holds a resource
+            uint32_t nextFree = SLOT_NONE;
+        };
+
+        uint32_t AcquireSlot()
+        {
+            if (m_freeHead != SLOT_NONE)
+            {
+                uint32_t index = m_freeHead;
+                m_freeHead = m_slots[index].nextFree;
+                return index;
+            }
+
+            uint32_t index = static_cast<uint32_t>(m_slots.size());
+            assert(index <= INDEX_MASK);
+
+            if ((index >> BLOCK_BITS) >= m_blocks.size())
+            {
+                m_blocks.push_back(static_cast<T*>(::operator new(sizeof(T) * BLOCK_SIZE)));
+            }
+
+            m_slots.push_back(Slot());
+            return index;
+        }
+
+        T* SlotPointer(uint32_t index) const
+        {
+            return m_blocks[index >> BLOCK_BITS] + (index & (BLOCK_SIZE - 1));
+        }
+
+        std::vector<Slot> m_slots;
+        std::vector<T*> m_blocks;
+        uint32_t m_freeHead = SLOT_NONE;
     };
 
     enum class Extension
     {
-        Raytracing
+        Raytracing,
+        /*
+        Descriptor Indexing, Every Sampled Image And Sampler Gets A Slot In One Global Set
+        */
+        Bindless
     };
 
     struct InitialDescription
@@ -148,7 +231,12 @@ namespace GFX
         VertexBuffer,
         UniformBuffer,
         IndexBuffer,
-        TransferBuffer
+        TransferBuffer,
+        StorageBuffer,
+        /*
+        Draw Arguments And Draw Counts, Also Usable As A Storage Buffer So Compute Can Write Them
+        */
+        IndirectBuffer
     };
 
     enum class BufferStorageMode
@@ -168,6 +256,10 @@ namespace GFX
         BufferUsage usage;
         BufferStorageMode storageMode;
         size_t size = 0;
+        /*
+        Needs Extension::Raytracing, Which Enables Buffer Device Address
+        */
+        bool deviceAddress = false;
     };
 
     struct Buffer
@@ -175,6 +267,36 @@ namespace GFX
         uint32_t id = 0;
     };
 
+    /*
+    Indirect Draw Arguments, Same Layout As VkDrawIndirectCommand / VkDrawIndexedIndirectCommand
+    */
+    struct DrawIndirectCommand
+    {
+        uint32_t vertexCount = 0;
+        uint32_t instanceCount = 0;
+        uint32_t firstVertex = 0;
+        uint32_t firstInstance = 0;
+    };
+
+    struct DrawIndexedIndirectCommand
+    {
+        uint32_t indexCount = 0;
+        uint32_t instanceCount = 0;
+        uint32_t firstIndex = 0;
+        int32_t vertexOffset = 0;
+        uint32_t firstInstance = 0;
+    };
+
+    /*
+    Same Layout As VkDispatchIndirectCommand
+    */
+    struct DispatchIndirectCommand
+    {
+        uint32_t x = 0;
+        uint32_t y = 0;
+        uint32_t z = 0;
+    };
+
     enum class FrontFace
     {
         Clockwise,
@@ -200,6 +322,10 @@ namespace GFX
         SampledImage,
         ColorAttachment,
         DepthStencilAttachment,
+        /*
+        Kept In General Layout, Not Uploadable Through UpdateImageMemory
+        */
+        StorageImage,
     };
 
     enum class ImageSampleCount
@@ -409,7 +535,11 @@ namespace GFX
         VertexShader,
         LateFragmentTests,
         EarlyFragmentTests,
-        All
+        All,
+        ComputeShader,
+        DrawIndirect,
+        VertexInput,
+        Transfer
     };
 
     enum class Access
@@ -418,6 +548,13 @@ namespace GFX
         DepthStencilAttachmentWrite,
         ShaderRead,
         InputAttachmentRead,
+        ShaderWrite,
+        ShaderReadWrite,
+        IndirectCommandRead,
+        VertexAttributeRead,
+        IndexRead,
+        TransferRead,
+        TransferWrite
     };
 
     constexpr auto ExternalSubpass = (~0U);
@@ -452,11 +589,41 @@ namespace GFX
         UInt32,
     };
 
+    enum class SubpassContents
+    {
+        Inline,
+        /*
+        The Subpass Is Filled Only By ExecuteCommandLists
+        */
+        SecondaryCommandBuffers
+    };
+
+    /*
+    Vertex Attribute Formats, Normalized And Half Types Are Read As Floats In The Shader
+    */
     enum class ValueType
     {
         Float32x2,
         Float32x3,
-        UInt16
+        UInt16,
+        Float16x2,
+        Float16x4,
+        /*
+        [-1, 1], Value * 127 Rounded
+        */
+        SNorm8x4,
+        /*
+        [-1, 1], Value * 32767 Rounded
+        */
+        SNorm16x2,
+        /*
+        [0, 1], Value * 255 Rounded
+        */
+        UNorm8x4,
+        /*
+        One uint32_t, R In Bits 0-9, G In 10-19, B In 20-29, A In 30-31, Not Every Device Fetches It, Check IsVertexFormatSupported
+        */
+        A2B10G10R10SNorm
     };
 
     enum class BindingType
@@ -465,6 +632,10 @@ namespace GFX
         Instance
     };
 
+    /*
+    One Or More Vertex Streams, Each With Its Own Stride And Input Rate
+    Attributes And The Setters Apply To The Most Recently Added Binding, Binding 0 Is Added On First Use
+    */
     struct VertexBindings
     {
         struct AttributeDescription
@@ -472,44 +643,80 @@ namespace GFX
             uint32_t location = 0;
             ValueType type;
             size_t offset = 0;
+            /*
+            Index Into m_bindings
+            */
+            size_t bindingIndex = 0;
+        };
+
+        struct BindingDescription
+        {
+            uint32_t position = 0;
+            size_t strideSize = 0;
+            BindingType bindingType = BindingType::Vertex;
         };
 
+        void AddBinding(uint32_t position, size_t strideSize, BindingType bindingType = BindingType::Vertex)
+        {
+            BindingDescription desc = {};
+            desc.position = position;
+            desc.strideSize = strideSize;
+            desc.bindingType = bindingType;
+
+            m_bindings.push_back(desc);
+        }
+
         void AddAttribute(uint32_t location, size_t offset, ValueType type)
         {
             AttributeDescription desc = {};
             desc.offset = offset;
             desc.type = type;
             desc.location = location;
+            desc.bindingIndex = CurrentBindingIndex();
 
             m_layout.push_back(desc);
         }
 
         void SetStrideSize(size_t size)
         {
-            m_strideSize = size;
+            m_bindings[CurrentBindingIndex()].strideSize = size;
         }
 
         void SetBindingType(BindingType bindingType)
         {
-            m_bindingType = bindingType;
+            m_bindings[CurrentBindingIndex()].bindingType = bindingType;
         }
 
         void SetBindingPosition(uint32_t pos)
         {
-            m_bindingPosition = pos;
+            m_bindings[CurrentBindingIndex()].position = pos;
+        }
+
+        size_t CurrentBindingIndex()
+        {
+            if (m_bindings.empty())
+            {
+                m_bindings.push_back(BindingDescription());
+            }
+
+            return m_bindings.size() - 1;
         }
 
-        BindingType m_bindingType = BindingType::Vertex;
-        size_t m_strideSize = 0;
+        std::vector<BindingDescription> m_bindings;
         std::vector<AttributeDescription> m_layout;
-        uint32_t m_bindingPosition = 0;
     };
 
     enum class UniformType
     {
         UniformBuffer,
+        /*
+        Offset Supplied At Bind Time, Used With Transient Uniforms
+        */
+        DynamicUniformBuffer,
         SampledImage,
         InputAttachment,
+        StorageBuffer,
+        StorageImage,
     };
 
     struct UniformLayoutDescription
@@ -554,7 +761,12 @@ namespace GFX
     enum class UniformStorageMode
     {
         Dynamic,
-        Static
+        Static,
+        /*
+        Allocated From The Current Frame's Descriptor Pool, Only Valid Until EndFrame.
+        Create Between BeginFrame And EndFrame, Released Automatically, Do Not Destroy.
+        */
+        Transient
     };
 
     struct UniformBufferAtrribute
@@ -565,6 +777,12 @@ namespace GFX
         size_t range;
     };
 
+    struct UniformTransientBufferAttribute
+    {
+        uint32_t binding;
+        size_t range;
+    };
+
     struct UniformImageAttribute
     {
         uint32_t binding;
@@ -572,6 +790,12 @@ namespace GFX
         Sampler sampler;
     };
 
+    struct UniformStorageImageAttribute
+    {
+        uint32_t binding;
+        Image image;
+    };
+
     struct UniformInputAttachmentAttribute
     {
         uint32_t binding;
@@ -600,6 +824,18 @@ namespace GFX
             m_bufferAtrributes.push_back(attr);
         }
 
+        /*
+        Binds the per-frame transient uniform buffer, the binding must be DynamicUniformBuffer.
+        */
+        void AddTransientBufferAttribute(uint32_t binding, size_t range)
+        {
+            UniformTransientBufferAttribute attr = {};
+            attr.binding = binding;
+            attr.range = range;
+
+            m_transientBufferAttributes.push_back(attr);
+        }
+
         void AddImageAttribute(uint32_t binding, Image image, Sampler sampler)
         {
             UniformImageAttribute attr = {};
@@ -610,6 +846,15 @@ namespace GFX
             m_imageAttributes.push_back(attr);
         }
 
+        void AddStorageImageAttribute(uint32_t binding, Image image)
+        {
+            UniformStorageImageAttribute attr = {};
+            attr.binding = binding;
+            attr.image = image;
+
+            m_storageImageAttributes.push_back(attr);
+        }
+
         void AddInputAttachmentAttribute(uint32_t binding, RenderPass renderPass, uint32_t attachmentIndex)
         {
             UniformInputAttachmentAttribute attr = {};
@@ -644,7 +889,9 @@ namespace GFX
         UniformLayout m_layout;
         UniformStorageMode m_storageMode;
         std::vector<UniformBufferAtrribute> m_bufferAtrributes;
+        std::vector<UniformTransientBufferAttribute> m_transientBufferAttributes;
         std::vector<UniformImageAttribute> m_imageAttributes;
+        std::vector<UniformStorageImageAttribute> m_storageImageAttributes;
         std::vector<UniformInputAttachmentAttribute> m_inputAttachmentAttributes;
         std::vector<UniformSampledAttachmentAttribute> m_sampledAttachmentAttributes;
     };
@@ -659,6 +906,13 @@ namespace GFX
         bool enable = false;
     };
 
+    struct PushConstantRange
+    {
+        ShaderStage stage = ShaderStage::VertexFragment;
+        uint32_t offset = 0;
+        uint32_t size = 0;
+    };
+
     struct GraphicsPipelineDescription
     {
         std::vector<Shader> shaders;
@@ -672,6 +926,14 @@ namespace GFX
         FrontFace fronFace = FrontFace::CounterClockwise;
         CullFace cullFace = CullFace::Back;
         std::vector<BlendState> blendStates;
+        std::vector<PushConstantRange> pushConstantRanges;
+    };
+
+    struct ComputePipelineDescription
+    {
+        Shader shader;
+        UniformBindings uniformBindings;
+        std::vector<PushConstantRange> pushConstantRanges;
     };
 
     struct Pipeline
@@ -679,9 +941,98 @@ namespace GFX
         uint32_t id = 0;
     };
 
+    struct UploadTicket
+    {
+        uint64_t id = 0;
+    };
+
+    /*
+    Secondary Command Buffer Recorded By One Thread, Only Valid For The Frame It Was Begun In
+    */
+    struct CommandList
+    {
+        uint32_t id = 0;
+    };
+
+    struct RenderBundle
+    {
+        uint32_t id = 0;
+    };
+
+    struct TransientUniformAllocation
+    {
+        void* data = nullptr;
+        // Dynamic Offset To Pass To BindUniform
+        uint32_t offset = 0;
+    };
+
+    struct MemoryPoolStatistics
+    {
+        size_t blockCount = 0;
+        size_t allocationCount = 0;
+        /*
+        Bytes Reserved From The Driver
+        */
+        uint64_t reservedBytes = 0;
+        /*
+        Bytes Occupied By Live Allocations
+        */
+        uint64_t usedBytes = 0;
+    };
+
+    struct MemoryStatistics
+    {
+        MemoryPoolStatistics staticGeometry;
+        MemoryPoolStatistics dynamicUniform;
+        MemoryPoolStatistics staging;
+        MemoryPoolStatistics renderTarget;
+        /*
+        All Allocations, Including Oversized Ones Placed Outside The Pools
+        */
+        MemoryPoolStatistics total;
+    };
+
+    struct RenderStatistics
+    {
+        uint32_t drawCalls = 0;
+        uint32_t descriptorSetBindCalls = 0;
+        uint32_t descriptorSetsBound = 0;
+        /*
+        BindUniform Calls That Matched What Was Already Bound And Were Skipped
+        */
+        uint32_t redundantDescriptorSetBinds = 0;
+        uint32_t commandListsExecuted = 0;
+        uint32_t pipelineBinds = 0;
+        /*
+        Pipeline, Vertex / Index Buffer And Viewport / Scissor Calls Matching The Bound State, Not Recorded
+        */
+        uint32_t redundantPipelineBinds = 0;
+        uint32_t redundantBufferBinds = 0;
+        uint32_t redundantDynamicStates = 0;
+        uint32_t renderBundlesExecuted = 0;
+        /*
+        Indirect Draw Calls, Each Also Counted In drawCalls, Whatever The Number Of Draws It Sources
+        */
+        uint32_t indirectDrawCalls = 0;
+        uint32_t dispatchCalls = 0;
+    };
+
+    struct DescriptorStatistics
+    {
+        uint32_t persistentPoolCount = 0;
+        uint32_t persistentSetCount = 0;
+        /*
+        Pools And Sets Of The Frame Currently Being Recorded
+        */
+        uint32_t transientPoolCount = 0;
+        uint32_t transientSetCount = 0;
+    };
+
     void Init(const InitialDescription& desc);
 
     Pipeline CreatePipeline(const GraphicsPipelineDescription& desc);
+    Pipeline CreateComputePipeline(const ComputePipelineDescription& desc);
+    bool IsVertexFormatSupported(ValueType valueType);
     Shader CreateShader(const ShaderDescription& desc);
     RenderPass CreateRenderPass(const RenderPassDescription& desc);
     Buffer CreateBuffer(const BufferDescription& desc);
@@ -700,6 +1051,7 @@ namespace GFX
     void DestroySampler(const Sampler& sampler);
     void DestroyUniformLayout(const UniformLayout& uniformLayout);
     void DestroyUniform(const Uniform& uniform);
+    void DestroyRenderBundle(const RenderBundle& renderBundle);
 
     /*
     Buffer Operation
@@ -707,11 +1059,38 @@ namespace GFX
 
     size_t GetMinimumUniformBufferAlignment();
 
+    /*
+    Rounds size Up To A Multiple Of alignment, A Power Of Two, The Result Is At Least alignment
+    */
     size_t AlignmentSize(size_t size, size_t alignment);
     size_t UniformAlign(size_t size);
 
     void UpdateBuffer(Buffer buffer, size_t offset, size_t size, void* data);
 
+    /*
+    Dynamic buffers are mapped for their whole lifetime, uniform buffers keep one slot per swap chain image.
+    Inside a frame the pointer addresses the slot read by the current frame, writes there need no unmap.
+    Static buffers map a staging region, UnmapBuffer records the copy to device memory.
+    */
+    void* MapBuffer(Buffer buffer, size_t offset, size_t size);
+    void UnmapBuffer(Buffer buffer);
+    void* GetMappedPointer(Buffer buffer);
+
+    /*
+    Only For Buffers Created With deviceAddress
+    */
+    uint64_t GetBufferDeviceAddress(Buffer buffer);
+
+    /*
+    Upload Batch
+    Static buffer and image uploads issued between Begin and End are recorded into one submission.
+    Batches may nest, only the outermost End submits.
+    */
+    void BeginUploadBatch();
+    UploadTicket EndUploadBatch();
+    bool IsUploadComplete(UploadTicket ticket);
+    void WaitUpload(UploadTicket ticket);
+
     /*
     Image Operation
     */
@@ -723,30 +1102,129 @@ namespace GFX
     Uniforms
     */
     void BindUniform(Uniform uniform, uint32_t set);
+    void BindUniform(Uniform uniform, uint32_t set, uint32_t dynamicOffset);
     void UpdateUniformBuffer(Uniform uniform, uint32_t binding, void* data);
 
+    /*
+    Transient uniform memory is valid until the frame it was allocated in retires.
+    Write through data, then bind a uniform with a transient buffer attribute using offset.
+    Each frame gets 4 MB, exceeding it aborts, also in release builds.
+    */
+    TransientUniformAllocation AllocateTransientUniform(size_t size);
+
+    /*
+    Bindless
+    Requires Extension::Bindless. Set layout: binding 0 texture2D[], binding 1 sampler[].
+    Add GetBindlessUniformLayout to a pipeline's uniform bindings, then bind it once per frame.
+    It survives ApplyPipeline while the new pipeline has the bindless layout at the same set, otherwise bind it again.
+    Init turns the extension off when the device lacks a required descriptor indexing feature, check IsBindlessSupported.
+    */
+    bool IsBindlessSupported();
+    UniformLayout GetBindlessUniformLayout();
+    uint32_t GetBindlessIndex(Image image);
+    uint32_t GetBindlessIndex(Sampler sampler);
+    void BindBindlessUniform(uint32_t set);
+
+    /*
+    Statistics
+    */
+    MemoryStatistics GetMemoryStatistics();
+    /*
+    Counters Of The Last Completed Frame
+    */
+    RenderStatistics GetRenderStatistics();
+    DescriptorStatistics GetDescriptorStatistics();
+
     /*
     Rendering Operation
     */
 
     void Resize(int width, int height);
+    /*
+    Recreates The Attachments, Uniforms Referencing Them Move To New Descriptor Sets Without Waiting On The GPU, Call Outside BeginFrame / EndFrame
+    */
     void ResizeRenderPass(RenderPass renderPass, int width, int height);
 
     bool BeginFrame();
     void ApplyPipeline(Pipeline pipeline);
     void BindIndexBuffer(Buffer buffer, size_t offset, IndexType indexType);
     void BindVertexBuffer(Buffer buffer, size_t offset, uint32_t binding = 0);
+    /*
+    Binds buffers[i] At Binding firstBinding + i In One Call, offsets Matches buffers In Size
+    */
+    void BindVertexBuffers(uint32_t firstBinding, const std::vector<Buffer>& buffers, const std::vector<size_t>& offsets);
     void Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance);
     void DrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, uint32_t vertexOffset = 0, uint32_t firstInstance = 0);
+    /*
+    Indirect Draws, Arguments Are Read From An IndirectBuffer Filled On The CPU Or By Compute
+    Stride Defaults To The Tightly Packed Argument Struct, drawCount > 1 Needs multiDrawIndirect, Check IsMultiDrawIndirectSupported
+    */
+    void DrawIndirect(Buffer buffer, size_t offset, uint32_t drawCount, uint32_t stride = sizeof(DrawIndirectCommand));
+    void DrawIndexedIndirect(Buffer buffer, size_t offset, uint32_t drawCount, uint32_t stride = sizeof(DrawIndexedIndirectCommand));
+    /*
+    Draw Count Read From countBuffer As A uint32_t, Clamped To maxDrawCount, Check IsDrawIndirectCountSupported
+    */
+    void DrawIndirectCount(Buffer buffer, size_t offset, Buffer countBuffer, size_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride = sizeof(DrawIndirectCommand));
+    void DrawIndexedIndirectCount(Buffer buffer, size_t offset, Buffer countBuffer, size_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride = sizeof(DrawIndexedIndirectCommand));
+    bool IsDrawIndirectCountSupported();
+    bool IsMultiDrawIndirectSupported();
+    /*
+    Compute, Recorded On The Frame's Command Buffer Outside Render Passes, Apply A Compute Pipeline First
+    Uniforms Bound With BindUniform Go To The Bind Point Of The Applied Pipeline
+    */
+    void Dispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ);
+    void DispatchIndirect(Buffer buffer, size_t offset);
+    /*
+    Barriers, Outside Render Passes, Make Writes Of The Source Stage Visible To Reads Of The Destination Stage
+    Such As PipelineStage::ComputeShader / Access::ShaderWrite To PipelineStage::DrawIndirect / Access::IndirectCommandRead
+    */
+    void BufferBarrier(Buffer buffer, PipelineStage srcStage, Access srcAccess, PipelineStage dstStage, Access dstAccess);
+    /*
+    Fills A Static Buffer With A Repeated uint32_t On The GPU, Such As Resetting Draw Counts, A Transfer Stage Write
+    */
+    void FillBuffer(Buffer buffer, size_t offset, size_t size, uint32_t value);
+    void ImageBarrier(Image image, ImageLayout oldLayout, ImageLayout newLayout, PipelineStage srcStage, Access srcAccess, PipelineStage dstStage, Access dstAccess);
+    /*
+    Needs An Applied Pipeline Declaring A Range For stage That Covers [offset, offset + size)
+    */
+    void PushConstants(ShaderStage stage, uint32_t offset, uint32_t size, const void* data);
     void SetViewport(float x, float y, float w, float h);
     void SetScissor(float x, float y, float w, float h);
 
-    void BeginRenderPass(RenderPass renderPass, int offsetX, int offsetY, int width, int height);
-    void NextSubpass();
+    void BeginRenderPass(RenderPass renderPass, int offsetX, int offsetY, int width, int height, SubpassContents contents = SubpassContents::Inline);
+    void NextSubpass(SubpassContents contents = SubpassContents::Inline);
     // void BeginDefaultRenderPass();
     void EndRenderPass();
 
+    /*
+    Command Lists
+    Between BeginFrame And EndFrame any thread may record a list for one subpass, the recording calls above then write into it.
+    Resource creation is not thread safe, dynamic state such as viewport and scissor is not inherited and must be set in every list.
+    Lists are executed on the main thread inside a subpass begun with SubpassContents::SecondaryCommandBuffers.
+    */
+    CommandList BeginCommandList(RenderPass renderPass, uint32_t subpass);
+    void EndCommandList(CommandList commandList);
+    void ExecuteCommandLists(const std::vector<CommandList>& commandLists);
+
+    /*
+    Render Bundles
+    On the main thread, recording calls between BeginRenderBundle and EndRenderBundle are captured instead of recorded.
+    ExecuteRenderBundle replays them into a secondary command buffer per swap chain image and reuses it on later frames.
+    Viewport and scissor default to the whole render pass, resizing the pass re-records on demand.
+    Destroying a referenced pipeline, buffer, uniform or the render pass invalidates the bundle, check IsRenderBundleValid.
+    Transient uniforms and transient allocations must not be used inside a bundle.
+    */
+    RenderBundle BeginRenderBundle(RenderPass renderPass, uint32_t subpass);
+    void EndRenderBundle(RenderBundle renderBundle);
+    bool IsRenderBundleValid(RenderBundle renderBundle);
+    void ExecuteRenderBundle(RenderBundle renderBundle);
+
     void EndFrame();
 
+    /*
+    Destroy Every Resource Released By Destroy* Right Now, Waits For The Device To Be Idle
+    */
+    void FlushDeletions();
+
     void Shutdown();
 };
\ No newline at end of file
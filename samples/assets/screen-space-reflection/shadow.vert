@@ -12,8 +12,6 @@ layout(binding = 0) uniform UniformBufferObject
 } ubo;
 
 layout(location = 0) in vec3 inPosition;
-layout(location = 1) in vec3 inNormal;
-layout(location = 2) in vec2 inTexCoord;
 
 out gl_PerVertex 
 {
@@ -0,0 +1,40 @@
+#pragma once
+
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#define GLM_FORCE_RADIANS
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace Culling
+{
+	// Axis aligned boxes in structure of arrays layout, one component per array so four or eight boxes load at once
+	struct BoundsSoA
+	{
+		std::vector<float> minX;
+		std::vector<float> minY;
+		std::vector<float> minZ;
+		std::vector<float> maxX;
+		std::vector<float> maxY;
+		std::vector<float> maxZ;
+
+		void Add(const glm::vec3& min, const glm::vec3& max);
+		void Clear();
+		size_t Size() const;
+	};
+
+	// Six inward facing planes, a point p is inside when dot(plane.xyz, p) + plane.w >= 0 for all of them
+	struct Frustum
+	{
+		glm::vec4 planes[6];
+
+		// Depth range zero to one, works for perspective and orthographic projections
+		static Frustum FromViewProjection(const glm::mat4& viewProjection);
+	};
+
+	// Appends the indices of the boxes intersecting the frustum to visible, in increasing order
+	// Uses AVX or SSE when the compiler targets them, the scalar path handles the rest
+	void CullBoxes(const BoundsSoA& bounds, const Frustum& frustum, std::vector<uint32_t>& visible);
+	void CullBoxesScalar(const BoundsSoA& bounds, const Frustum& frustum, size_t first, std::vector<uint32_t>& visible);
+}
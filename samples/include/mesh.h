@@ -12,6 +12,7 @@
 #include <assimp/postprocess.h>
 
 #include "common.h"
+#include "culling.h"
 
 struct Vertex
 {
@@ -44,19 +45,36 @@ public:
 
 		vertexBuffer = GFX::CreateBuffer(vertexBufferDesc);
 
+		ChooseIndexType();
+
 		GFX::BufferDescription indexBufferDesc = {};
 		indexBufferDesc.usage = GFX::BufferUsage::IndexBuffer;
 		indexBufferDesc.storageMode = GFX::BufferStorageMode::Static;
-		indexBufferDesc.size = sizeof(uint32_t) * indices.size();
+		indexBufferDesc.size = (indexType == GFX::IndexType::UInt16 ? sizeof(uint16_t) : sizeof(uint32_t)) * indices.size();
 
 		indexBuffer = GFX::CreateBuffer(indexBufferDesc);
 
 		GFX::UpdateBuffer(vertexBuffer, 0, vertexBufferDesc.size, (void*)vertices.data());
-		GFX::UpdateBuffer(indexBuffer, 0, indexBufferDesc.size, (void*)indices.data());
+
+		if (indexType == GFX::IndexType::UInt16)
+		{
+			std::vector<uint16_t> shortIndices(indices.begin(), indices.end());
+			GFX::UpdateBuffer(indexBuffer, 0, indexBufferDesc.size, (void*)shortIndices.data());
+		}
+		else
+		{
+			GFX::UpdateBuffer(indexBuffer, 0, indexBufferDesc.size, (void*)indices.data());
+		}
 
 		gpuResourceInitialized = true;
 	}
 
+	// Every index fits in 16 bits below 65536 vertices
+	void ChooseIndexType()
+	{
+		indexType = vertices.size() < 65536 ? GFX::IndexType::UInt16 : GFX::IndexType::UInt32;
+	}
+
 	void DestroyGPUResources()
 	{
 		GFX::DestroyBuffer(vertexBuffer);
@@ -66,11 +84,13 @@ public:
 	glm::mat4 transform = glm::mat4(1.0f);
 	// vec3 pos, vec3 normal, vec2 uv
 	std::vector<Vertex> vertices;
+	// Always 32 bit on the CPU, indexBuffer holds them as indexType
 	std::vector<uint32_t> indices;
 	std::string name;
 
 	GFX::Buffer vertexBuffer;
 	GFX::Buffer indexBuffer;
+	GFX::IndexType indexType = GFX::IndexType::UInt32;
 
 	bool gpuResourceInitialized = false;
 };
@@ -79,8 +99,11 @@ class Scene
 {
 public:
 	std::vector<Mesh*> meshes;
+	// World space box of meshes[i] at index i
+	Culling::BoundsSoA bounds;
 };
 
-Scene* LoadScene(const char* path, glm::vec3& min, glm::vec3& max);
+// createGPUResources false keeps the meshes on the CPU, for callers that upload the scene their own way
+Scene* LoadScene(const char* path, glm::vec3& min, glm::vec3& max, bool createGPUResources = true);
 
 void DestroyScene(Scene* scene);
\ No newline at end of file
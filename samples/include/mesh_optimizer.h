@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "mesh.h"
+
+// FIFO cache the orderings are tuned for and the statistics are measured with
+#define VERTEX_CACHE_SIZE 16
+
+namespace MeshOptimizer
+{
+	struct VertexCacheStatistics
+	{
+		size_t misses = 0;
+		size_t triangleCount = 0;
+		size_t vertexCount = 0;
+
+		// Average cache miss ratio, transformed vertices per triangle, 0.5 is the best a regular grid gets, 3 the worst
+		float ACMR() const;
+		// Average transform to vertex ratio, 1 means every vertex is shaded once
+		float ATVR() const;
+
+		void Accumulate(const VertexCacheStatistics& other);
+	};
+
+	VertexCacheStatistics AnalyzeVertexCache(const std::vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize = VERTEX_CACHE_SIZE);
+
+	// Merges bitwise identical vertices, returns the new vertex count
+	size_t WeldVertices(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+	// Tipsify, Sander et al. 2007, reorders triangles for the post transform cache
+	void OptimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize = VERTEX_CACHE_SIZE);
+	// Splits the cache ordered triangles where the cache starts cold and draws outward facing clusters first
+	// Run after OptimizeVertexCache, the cache behaviour inside a cluster is kept
+	void OptimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices, uint32_t cacheSize = VERTEX_CACHE_SIZE);
+	// Stores vertices in the order the index buffer first touches them, unreferenced vertices are dropped
+	size_t OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+
+	// All of the above in order, before and after are measured on the input and on the result
+	void OptimizeMesh(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices, VertexCacheStatistics* before = nullptr, VertexCacheStatistics* after = nullptr);
+}
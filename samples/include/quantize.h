@@ -0,0 +1,29 @@
+#pragma once
+
+#include <gfx.h>
+
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#define GLM_FORCE_RADIANS
+#include <glm/glm.hpp>
+
+#include <cstdint>
+
+namespace Quantize
+{
+	// Round half away from zero, values outside the format's range are clamped
+	// Uses SSE2 when the compiler targets it, the scalar path handles the rest, both give the same bits
+	void FloatToHalf(const float* src, uint16_t* dst, size_t count);
+	void FloatToSNorm8(const float* src, int8_t* dst, size_t count);
+	void FloatToSNorm16(const float* src, int16_t* dst, size_t count);
+	void FloatToUNorm8(const float* src, uint8_t* dst, size_t count);
+
+	// Denormals flush to zero, NaN stays NaN
+	uint16_t FloatToHalf(float value);
+	// A2B10G10R10 SNorm with alpha 0
+	uint32_t PackSNorm10x3(const glm::vec3& value);
+
+	// Unit normals into one uint32_t each, type is ValueType::SNorm8x4 or ValueType::A2B10G10R10SNorm
+	void QuantizeNormals(const glm::vec3* normals, size_t count, GFX::ValueType type, uint32_t* dst);
+	// Two halfs per texture coordinate, for ValueType::Float16x2
+	void QuantizeTexCoords(const glm::vec2* texCoords, size_t count, uint16_t* dst);
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Threads that live as long as the pool, so per frame work does not pay for thread creation
+// Start and Wait are called from one thread, one job runs at a time
+class WorkerPool
+{
+public:
+	explicit WorkerPool(uint32_t threadCount);
+	~WorkerPool();
+
+	WorkerPool(const WorkerPool&) = delete;
+	WorkerPool& operator=(const WorkerPool&) = delete;
+
+	// Runs job(workerIndex) once on every worker, returns without waiting
+	void Start(const std::function<void(uint32_t)>& job);
+	// Blocks until every worker finished the job given to Start
+	void Wait();
+
+	uint32_t ThreadCount() const;
+
+private:
+	void Run(uint32_t workerIndex);
+
+	std::vector<std::thread> m_threads;
+	std::mutex m_mutex;
+	std::condition_variable m_wake;
+	std::condition_variable m_done;
+	std::function<void(uint32_t)> m_job;
+	uint32_t m_pending = 0;
+	uint64_t m_generation = 0;
+	bool m_exit = false;
+};
@@ -15,6 +15,9 @@
 #include <assimp/postprocess.h>
 
 #include "string_utils.h"
+#include "culling.h"
+
+#include <chrono>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
@@ -110,6 +113,10 @@ class Scene
 {
 public:
 	std::vector<Mesh*> meshes;
+	// World space box of meshes[i] at index i
+	Culling::BoundsSoA bounds;
+	// Indices into meshes that passed the last frustum test
+	std::vector<uint32_t> visibleMeshes;
 };
 
 const int WIDTH = 800;
@@ -379,9 +386,16 @@ Scene* LoadScene(const char* path)
 {
 	Scene* result = new Scene();
 
+	auto importStart = std::chrono::high_resolution_clock::now();
+
 	Assimp::Importer meshImporter;
 	const aiScene* aiScene = meshImporter.ReadFile(path, aiProcess_OptimizeGraph | aiProcess_OptimizeMeshes);
 
+	auto uploadStart = std::chrono::high_resolution_clock::now();
+
+	// Every Mesh Upload Goes Into One Submission
+	GFX::BeginUploadBatch();
+
 	float minX = INFINITY;
 	float minY = INFINITY;
 	float minZ = INFINITY;
@@ -394,6 +408,9 @@ Scene* LoadScene(const char* path)
 		aiMesh* aiMesh = aiScene->mMeshes[i];
 		Mesh* mesh = new Mesh();
 		mesh->name = aiMesh->mName.C_Str();
+
+		glm::vec3 meshMin = glm::vec3(INFINITY);
+		glm::vec3 meshMax = glm::vec3(-INFINITY);
 		
 		mesh->indices.resize(aiMesh->mNumFaces * 3);
 		for (size_t f = 0; f < aiMesh->mNumFaces; ++f)
@@ -423,6 +440,9 @@ Scene* LoadScene(const char* path)
 			maxY = Math::Max(vertex.position.y, maxY);
 			maxZ = Math::Max(vertex.position.z, maxZ);
 
+			meshMin = glm::min(meshMin, vertex.position);
+			meshMax = glm::max(meshMax, vertex.position);
+
 			mesh->vertices.push_back(vertex);
 		}
 
@@ -432,8 +452,18 @@ Scene* LoadScene(const char* path)
 		mesh->CreateGPUResources();
 
 		result->meshes.push_back(mesh);
+		result->bounds.Add(meshMin, meshMax);
 	}
 
+	GFX::UploadTicket uploadTicket = GFX::EndUploadBatch();
+	GFX::WaitUpload(uploadTicket);
+
+	auto loadEnd = std::chrono::high_resolution_clock::now();
+
+	double importMs = std::chrono::duration<double, std::milli>(uploadStart - importStart).count();
+	double uploadMs = std::chrono::duration<double, std::milli>(loadEnd - uploadStart).count();
+	spdlog::info("LoadScene {}: {} meshes, import {:.2f} ms, build and upload {:.2f} ms", path, result->meshes.size(), importMs, uploadMs);
+
 	return result;
 }
 
@@ -669,8 +699,13 @@ void ModelViewerExample::MainLoop()
 			GFX::ApplyPipeline(s_meshPipeline);
 			// scene
 			GFX::BindUniform(s_modelUniform->uniform, 0);
-			for (auto mesh : s_scene->meshes)
+
+			s_scene->visibleMeshes.clear();
+			Culling::CullBoxes(s_scene->bounds, Culling::Frustum::FromViewProjection(ubo.proj * ubo.view), s_scene->visibleMeshes);
+
+			for (auto meshIndex : s_scene->visibleMeshes)
 			{
+				auto mesh = s_scene->meshes[meshIndex];
 				GFX::BindIndexBuffer(mesh->indexBuffer, 0, GFX::IndexType::UInt32);
 				GFX::BindVertexBuffer(mesh->vertexBuffer, 0);
 				GFX::DrawIndexed(mesh->indices.size(), 1, 0);
@@ -15,6 +15,7 @@
 #include <assimp/postprocess.h>
 
 #include "string_utils.h"
+#include "culling.h"
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
@@ -110,6 +111,10 @@ class Scene
 {
 public:
 	std::vector<Mesh*> meshes;
+	// World space box of meshes[i] at index i
+	Culling::BoundsSoA bounds;
+	// Indices into meshes that passed the last frustum test
+	std::vector<uint32_t> visibleMeshes;
 };
 
 const int WIDTH = 800;
@@ -394,6 +399,9 @@ Scene* LoadScene(const char* path)
 		aiMesh* aiMesh = aiScene->mMeshes[i];
 		Mesh* mesh = new Mesh();
 		mesh->name = aiMesh->mName.C_Str();
+
+		glm::vec3 meshMin = glm::vec3(INFINITY);
+		glm::vec3 meshMax = glm::vec3(-INFINITY);
 		
 		mesh->indices.resize(aiMesh->mNumFaces * 3);
 		for (size_t f = 0; f < aiMesh->mNumFaces; ++f)
@@ -423,6 +431,9 @@ Scene* LoadScene(const char* path)
 			maxY = Math::Max(vertex.position.y, maxY);
 			maxZ = Math::Max(vertex.position.z, maxZ);
 
+			meshMin = glm::min(meshMin, vertex.position);
+			meshMax = glm::max(meshMax, vertex.position);
+
 			mesh->vertices.push_back(vertex);
 		}
 
@@ -432,6 +443,7 @@ Scene* LoadScene(const char* path)
 		mesh->CreateGPUResources();
 
 		result->meshes.push_back(mesh);
+		result->bounds.Add(meshMin, meshMax);
 	}
 
 	return result;
@@ -677,8 +689,13 @@ void RaytracingExample::MainLoop()
 			GFX::ApplyPipeline(s_meshPipeline);
 			// scene
 			GFX::BindUniform(s_modelUniform->uniform, 0);
-			for (auto mesh : s_scene->meshes)
+
+			s_scene->visibleMeshes.clear();
+			Culling::CullBoxes(s_scene->bounds, Culling::Frustum::FromViewProjection(ubo.proj * ubo.view), s_scene->visibleMeshes);
+
+			for (auto meshIndex : s_scene->visibleMeshes)
 			{
+				auto mesh = s_scene->meshes[meshIndex];
 				GFX::BindIndexBuffer(mesh->indexBuffer, 0, GFX::IndexType::UInt32);
 				GFX::BindVertexBuffer(mesh->vertexBuffer, 0);
 				GFX::DrawIndexed(mesh->indices.size(), 1, 0);
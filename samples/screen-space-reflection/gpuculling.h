@@ -0,0 +1,345 @@
+#pragma once
+#include <gfx.h>
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#define GLM_FORCE_RADIANS
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include "string_utils.h"
+#include "culling.h"
+#include "mesh.h"
+#include "quantize.h"
+
+// Views the scene is culled for, each one gets its own compacted draw list
+#define CULL_VIEW_GBUFFER_OPAQUE 0
+#define CULL_VIEW_GBUFFER_WATER 1
+#define CULL_VIEW_SHADOW_CASCADE0 2
+#define CULL_VIEW_COUNT 5
+
+#define CULL_GROUP_SIZE 64
+
+class GPUCulling
+{
+public:
+	~GPUCulling()
+	{
+		GFX::DestroyPipeline(pipeline);
+		GFX::DestroyShader(cullShader);
+		GFX::DestroyUniform(uniform);
+		GFX::DestroyUniformLayout(uniformLayout);
+		GFX::DestroyBuffer(objectBuffer);
+		GFX::DestroyBuffer(drawBuffer);
+		GFX::DestroyBuffer(countBuffer);
+		GFX::DestroyBuffer(positionBuffer);
+		GFX::DestroyBuffer(attributeBuffer);
+		GFX::DestroyBuffer(indexBuffer);
+	}
+
+	// Matches ObjectData in cull.comp, std430
+	struct ObjectData
+	{
+		// xyz center, w radius
+		glm::vec4 sphere;
+		glm::vec4 aabbMin;
+		glm::vec4 aabbMax;
+		uint32_t indexCount;
+		uint32_t firstIndex;
+		int32_t vertexOffset;
+		// Bit n set when the object is drawn in view n
+		uint32_t viewMask;
+	};
+
+	// Vertex stream 1, stream 0 holds the positions alone so depth only passes fetch 12 bytes per vertex
+	// 8 bytes instead of 20, normalType and uvType describe the encoding
+	struct SurfaceAttributes
+	{
+		uint32_t normal;
+		uint16_t uv[2];
+	};
+
+	struct CullUniformObject
+	{
+		glm::vec4 planes[CULL_VIEW_COUNT * 6];
+		// object count, unused, unused, unused
+		glm::uvec4 objectCount;
+	};
+
+	// viewMasks holds one mask per mesh, the scene geometry is merged into two vertex streams and one index buffer
+	static GPUCulling* Create(Scene* scene, const std::vector<uint32_t>& viewMasks)
+	{
+		auto result = new GPUCulling();
+
+		result->CreateSceneBuffers(scene, viewMasks);
+		result->CreateDrawBuffers();
+		result->CreateShader();
+		result->CreatePipeline();
+
+		return result;
+	}
+
+	// Outside render passes, before any pass that calls Draw
+	void Cull(const std::array<glm::mat4, CULL_VIEW_COUNT>& viewProjections)
+	{
+		CullUniformObject ubo = {};
+		for (uint32_t i = 0; i < CULL_VIEW_COUNT; i++)
+		{
+			Culling::Frustum frustum = Culling::Frustum::FromViewProjection(viewProjections[i]);
+			std::copy(frustum.planes, frustum.planes + 6, &ubo.planes[i * 6]);
+		}
+		ubo.objectCount = glm::uvec4(objectCount, 0, 0, 0);
+
+		auto allocation = GFX::AllocateTransientUniform(sizeof(CullUniformObject));
+		memcpy(allocation.data, &ubo, sizeof(CullUniformObject));
+
+		// The previous frame may still read the draw lists
+		GFX::BufferBarrier(countBuffer, GFX::PipelineStage::DrawIndirect, GFX::Access::IndirectCommandRead, GFX::PipelineStage::Transfer, GFX::Access::TransferWrite);
+		GFX::FillBuffer(countBuffer, 0, sizeof(uint32_t) * CULL_VIEW_COUNT, 0);
+		GFX::BufferBarrier(countBuffer, GFX::PipelineStage::Transfer, GFX::Access::TransferWrite, GFX::PipelineStage::ComputeShader, GFX::Access::ShaderReadWrite);
+
+		if (drawCountSupported)
+		{
+			GFX::BufferBarrier(drawBuffer, GFX::PipelineStage::DrawIndirect, GFX::Access::IndirectCommandRead, GFX::PipelineStage::ComputeShader, GFX::Access::ShaderWrite);
+		}
+		else
+		{
+			// Without a GPU draw count every slot is drawn, the ones past the compacted list stay empty
+			GFX::BufferBarrier(drawBuffer, GFX::PipelineStage::DrawIndirect, GFX::Access::IndirectCommandRead, GFX::PipelineStage::Transfer, GFX::Access::TransferWrite);
+			GFX::FillBuffer(drawBuffer, 0, sizeof(GFX::DrawIndexedIndirectCommand) * objectCount * CULL_VIEW_COUNT, 0);
+			GFX::BufferBarrier(drawBuffer, GFX::PipelineStage::Transfer, GFX::Access::TransferWrite, GFX::PipelineStage::ComputeShader, GFX::Access::ShaderWrite);
+		}
+
+		GFX::ApplyPipeline(pipeline);
+		GFX::BindUniform(uniform, 0, allocation.offset);
+		GFX::Dispatch((objectCount + CULL_GROUP_SIZE - 1) / CULL_GROUP_SIZE, CULL_VIEW_COUNT, 1);
+
+		GFX::BufferBarrier(drawBuffer, GFX::PipelineStage::ComputeShader, GFX::Access::ShaderWrite, GFX::PipelineStage::DrawIndirect, GFX::Access::IndirectCommandRead);
+		GFX::BufferBarrier(countBuffer, GFX::PipelineStage::ComputeShader, GFX::Access::ShaderReadWrite, GFX::PipelineStage::DrawIndirect, GFX::Access::IndirectCommandRead);
+	}
+
+	// One indirect draw of the visible objects of a view, the pipeline and uniforms are bound by the caller
+	// positionsOnly binds stream 0 alone, for pipelines without the surface attributes
+	void Draw(uint32_t view, bool positionsOnly = false)
+	{
+		size_t drawOffset = sizeof(GFX::DrawIndexedIndirectCommand) * objectCount * view;
+
+		if (positionsOnly)
+		{
+			GFX::BindVertexBuffer(positionBuffer, 0);
+		}
+		else
+		{
+			GFX::BindVertexBuffers(0, { positionBuffer, attributeBuffer }, { 0, 0 });
+		}
+		GFX::BindIndexBuffer(indexBuffer, 0, indexType);
+
+		if (drawCountSupported)
+		{
+			GFX::DrawIndexedIndirectCount(drawBuffer, drawOffset, countBuffer, sizeof(uint32_t) * view, objectCount);
+		}
+		else if (multiDrawSupported)
+		{
+			GFX::DrawIndexedIndirect(drawBuffer, drawOffset, objectCount);
+		}
+		else
+		{
+			// One command per draw, the empty slots past the visible ones draw nothing
+			for (uint32_t i = 0; i < objectCount; i++)
+			{
+				GFX::DrawIndexedIndirect(drawBuffer, drawOffset + sizeof(GFX::DrawIndexedIndirectCommand) * i, 1);
+			}
+		}
+	}
+
+	uint32_t objectCount = 0;
+	bool drawCountSupported = false;
+	bool multiDrawSupported = false;
+
+	// A2B10G10R10SNorm where the device fetches it, SNorm8x4 otherwise
+	GFX::ValueType normalType = GFX::ValueType::SNorm8x4;
+	const GFX::ValueType uvType = GFX::ValueType::Float16x2;
+
+	GFX::Buffer positionBuffer = {};
+	GFX::Buffer attributeBuffer = {};
+	GFX::Buffer indexBuffer = {};
+	// UInt16 when every mesh has 16 bit indices, they are relative to the object's vertexOffset
+	GFX::IndexType indexType = GFX::IndexType::UInt16;
+
+	GFX::Buffer objectBuffer = {};
+	// CULL_VIEW_COUNT lists of objectCount draws
+	GFX::Buffer drawBuffer = {};
+	// One draw count per view
+	GFX::Buffer countBuffer = {};
+
+	GFX::UniformLayout uniformLayout = {};
+	GFX::Uniform uniform = {};
+	GFX::Shader cullShader = {};
+	GFX::Pipeline pipeline = {};
+
+private:
+	void CreateSceneBuffers(Scene* scene, const std::vector<uint32_t>& viewMasks)
+	{
+		std::vector<glm::vec3> positions;
+		std::vector<glm::vec3> normals;
+		std::vector<glm::vec2> uvs;
+		std::vector<uint32_t> indices;
+		std::vector<ObjectData> objects;
+
+		for (size_t i = 0; i < scene->meshes.size(); i++)
+		{
+			auto mesh = scene->meshes[i];
+
+			const Culling::BoundsSoA& bounds = scene->bounds;
+			glm::vec3 minP = glm::vec3(bounds.minX[i], bounds.minY[i], bounds.minZ[i]);
+			glm::vec3 maxP = glm::vec3(bounds.maxX[i], bounds.maxY[i], bounds.maxZ[i]);
+
+			ObjectData object = {};
+			object.sphere = glm::vec4(0.5f * (minP + maxP), 0.5f * glm::length(maxP - minP));
+			object.aabbMin = glm::vec4(minP, 0.0f);
+			object.aabbMax = glm::vec4(maxP, 0.0f);
+			object.indexCount = mesh->indices.size();
+			object.firstIndex = indices.size();
+			if (mesh->indexType == GFX::IndexType::UInt32)
+			{
+				indexType = GFX::IndexType::UInt32;
+			}
+			object.vertexOffset = positions.size();
+			object.viewMask = viewMasks[i];
+			objects.push_back(object);
+
+			for (auto& vertex : mesh->vertices)
+			{
+				positions.push_back(vertex.position);
+				normals.push_back(vertex.normal);
+				uvs.push_back(vertex.uv);
+			}
+			indices.insert(indices.end(), mesh->indices.begin(), mesh->indices.end());
+		}
+
+		objectCount = objects.size();
+
+		if (GFX::IsVertexFormatSupported(GFX::ValueType::A2B10G10R10SNorm))
+		{
+			normalType = GFX::ValueType::A2B10G10R10SNorm;
+		}
+
+		std::vector<uint32_t> packedNormals(normals.size());
+		std::vector<uint16_t> packedUVs(uvs.size() * 2);
+		Quantize::QuantizeNormals(normals.data(), normals.size(), normalType, packedNormals.data());
+		Quantize::QuantizeTexCoords(uvs.data(), uvs.size(), packedUVs.data());
+
+		std::vector<SurfaceAttributes> attributes(positions.size());
+		for (size_t i = 0; i < attributes.size(); i++)
+		{
+			attributes[i].normal = packedNormals[i];
+			attributes[i].uv[0] = packedUVs[i * 2 + 0];
+			attributes[i].uv[1] = packedUVs[i * 2 + 1];
+		}
+
+		GFX::BeginUploadBatch();
+
+		GFX::BufferDescription positionBufferDesc = {};
+		positionBufferDesc.usage = GFX::BufferUsage::VertexBuffer;
+		positionBufferDesc.storageMode = GFX::BufferStorageMode::Static;
+		positionBufferDesc.size = sizeof(glm::vec3) * positions.size();
+		positionBuffer = GFX::CreateBuffer(positionBufferDesc);
+		GFX::UpdateBuffer(positionBuffer, 0, positionBufferDesc.size, positions.data());
+
+		GFX::BufferDescription attributeBufferDesc = {};
+		attributeBufferDesc.usage = GFX::BufferUsage::VertexBuffer;
+		attributeBufferDesc.storageMode = GFX::BufferStorageMode::Static;
+		attributeBufferDesc.size = sizeof(SurfaceAttributes) * attributes.size();
+		attributeBuffer = GFX::CreateBuffer(attributeBufferDesc);
+		GFX::UpdateBuffer(attributeBuffer, 0, attributeBufferDesc.size, attributes.data());
+
+		GFX::BufferDescription indexBufferDesc = {};
+		indexBufferDesc.usage = GFX::BufferUsage::IndexBuffer;
+		indexBufferDesc.storageMode = GFX::BufferStorageMode::Static;
+		indexBufferDesc.size = (indexType == GFX::IndexType::UInt16 ? sizeof(uint16_t) : sizeof(uint32_t)) * indices.size();
+		indexBuffer = GFX::CreateBuffer(indexBufferDesc);
+
+		if (indexType == GFX::IndexType::UInt16)
+		{
+			std::vector<uint16_t> shortIndices(indices.begin(), indices.end());
+			GFX::UpdateBuffer(indexBuffer, 0, indexBufferDesc.size, shortIndices.data());
+		}
+		else
+		{
+			GFX::UpdateBuffer(indexBuffer, 0, indexBufferDesc.size, indices.data());
+		}
+
+		GFX::BufferDescription objectBufferDesc = {};
+		objectBufferDesc.usage = GFX::BufferUsage::StorageBuffer;
+		objectBufferDesc.storageMode = GFX::BufferStorageMode::Static;
+		objectBufferDesc.size = sizeof(ObjectData) * objects.size();
+		objectBuffer = GFX::CreateBuffer(objectBufferDesc);
+		GFX::UpdateBuffer(objectBuffer, 0, objectBufferDesc.size, objects.data());
+
+		GFX::WaitUpload(GFX::EndUploadBatch());
+	}
+
+	void CreateDrawBuffers()
+	{
+		drawCountSupported = GFX::IsDrawIndirectCountSupported();
+		multiDrawSupported = GFX::IsMultiDrawIndirectSupported();
+
+		GFX::BufferDescription drawBufferDesc = {};
+		drawBufferDesc.usage = GFX::BufferUsage::IndirectBuffer;
+		drawBufferDesc.storageMode = GFX::BufferStorageMode::Static;
+		drawBufferDesc.size = sizeof(GFX::DrawIndexedIndirectCommand) * objectCount * CULL_VIEW_COUNT;
+		drawBuffer = GFX::CreateBuffer(drawBufferDesc);
+
+		GFX::BufferDescription countBufferDesc = {};
+		countBufferDesc.usage = GFX::BufferUsage::IndirectBuffer;
+		countBufferDesc.storageMode = GFX::BufferStorageMode::Static;
+		countBufferDesc.size = sizeof(uint32_t) * CULL_VIEW_COUNT;
+		countBuffer = GFX::CreateBuffer(countBufferDesc);
+	}
+
+	void CreateShader()
+	{
+		GFX::ShaderDescription cullShaderDesc = {};
+		cullShaderDesc.codes = StringUtils::ReadFile("screen-space-reflection/cull.comp");
+		cullShaderDesc.stage = GFX::ShaderStage::Compute;
+		cullShaderDesc.name = "screen-space-reflection/cull.comp";
+
+		cullShader = GFX::CreateShader(cullShaderDesc);
+	}
+
+	void CreatePipeline()
+	{
+		GFX::UniformLayoutDescription uniformLayoutDesc = {};
+		// Objects
+		uniformLayoutDesc.AddUniformBinding(0, GFX::UniformType::StorageBuffer, GFX::ShaderStage::Compute, 1);
+		// Draws
+		uniformLayoutDesc.AddUniformBinding(1, GFX::UniformType::StorageBuffer, GFX::ShaderStage::Compute, 1);
+		// Counts
+		uniformLayoutDesc.AddUniformBinding(2, GFX::UniformType::StorageBuffer, GFX::ShaderStage::Compute, 1);
+		// Frustums, written every frame into transient uniform memory
+		uniformLayoutDesc.AddUniformBinding(3, GFX::UniformType::DynamicUniformBuffer, GFX::ShaderStage::Compute, 1);
+		uniformLayout = GFX::CreateUniformLayout(uniformLayoutDesc);
+
+		GFX::UniformDescription uniformDesc = {};
+		uniformDesc.SetUniformLayout(uniformLayout);
+		uniformDesc.SetStorageMode(GFX::UniformStorageMode::Static);
+		uniformDesc.AddBufferAttribute(0, objectBuffer, 0, sizeof(ObjectData) * objectCount);
+		uniformDesc.AddBufferAttribute(1, drawBuffer, 0, sizeof(GFX::DrawIndexedIndirectCommand) * objectCount * CULL_VIEW_COUNT);
+		uniformDesc.AddBufferAttribute(2, countBuffer, 0, sizeof(uint32_t) * CULL_VIEW_COUNT);
+		uniformDesc.AddTransientBufferAttribute(3, sizeof(CullUniformObject));
+		uniform = GFX::CreateUniform(uniformDesc);
+
+		GFX::UniformBindings uniformBindings = {};
+		uniformBindings.AddUniformLayout(uniformLayout);
+
+		GFX::ComputePipelineDescription pipelineDesc = {};
+		pipelineDesc.shader = cullShader;
+		pipelineDesc.uniformBindings = uniformBindings;
+		pipeline = GFX::CreateComputePipeline(pipelineDesc);
+	}
+
+	GPUCulling()
+	{
+	}
+};
@@ -24,6 +24,7 @@
 
 #include "shadowmap.h"
 #include "camera.h"
+#include "gpuculling.h"
 
 #define ALBEDO_ATTACHMENT_INDEX 1
 #define NORMAL_ATTACHMENT_INDEX 2
@@ -96,6 +97,8 @@ GFX::RenderPass s_meshRenderPass;
 static PipelineObject* s_meshPipelineObject = nullptr;
 
 static PipelineObject* s_meshMRTPipelineObject = nullptr;
+// Static Scene Geometry Of The G Buffer Subpass, Recorded Once
+static GFX::RenderBundle s_gBufferBundle;
 static PipelineObject* s_gatherPipelineObject = nullptr;
 static PipelineObject* s_presentPipelineObject = nullptr;
 static SSRPass* s_ssrPass = nullptr;
@@ -113,6 +116,7 @@ static GFX::Buffer s_gatheringPassUniformBuffer;
 static GFX::Image s_irradianceMap;
 
 static ShadowMap* s_shadowMap;
+static GPUCulling* s_culling = nullptr;
 
 static Camera* s_camera = nullptr;
 static Skybox* skybox = nullptr;
@@ -352,12 +356,6 @@ struct PresentUniform
 		uniform = GFX::CreateUniform(uniformDesc);
 	}
 
-	void Resize()
-	{
-		GFX::DestroyUniform(uniform);
-		CreateUniform();
-	}
-
 	void UpdateUniform()
 	{
 		ubo.WidthHeightExposureNo = glm::vec4(s_width, s_height, s_exposure, 0.0f);
@@ -394,12 +392,6 @@ struct SSRBlurPass
 		delete pipeline;
 	}
 
-	void Resize()
-	{
-		GFX::DestroyUniform(uniform);
-		CreateUniform();
-	}
-
 	void CreateUniformLayout()
 	{
 		GFX::UniformLayoutDescription uniformLayoutDesc = {};
@@ -475,12 +467,6 @@ struct SSRPass
 		GFX::DestroyBuffer(buffer);
 	}
 
-	void Resize()
-	{
-		GFX::DestroyUniform(uniform);
-		CreateUniform();
-	}
-
 	void CreateBuffer()
 	{
 		GFX::BufferDescription bufferDesc = {};
@@ -564,8 +550,6 @@ float deltaTime = 0.0f;	// time between current frame and last frame
 float lastFrame = 0.0f;
 static glm::vec3 target;
 
-void CreateGahteringUniform();
-
 static void framebufferResizeCallback(GLFWwindow* window, int width, int height)
 {
 	s_width = width;
@@ -573,16 +557,8 @@ static void framebufferResizeCallback(GLFWwindow* window, int width, int height)
 
 	// spdlog::info("Window Resize");
 	GFX::Resize(width, height);
+	// Uniforms Referencing The Attachments Are Refreshed By The Render Pass
 	GFX::ResizeRenderPass(s_meshRenderPass, width, height);
-
-	// Recreate Attachment Relavant Uniform
-	
-	GFX::DestroyUniform(s_gatherUniform);
-	CreateGahteringUniform();
-
-	presentUniform->Resize();
-	s_ssrPass->Resize();
-	s_ssrBlurPass->Resize();
 }
 
 float lastX = s_width / 2.0f;
@@ -927,13 +903,13 @@ GFX::RenderPass CreateScreenSpaceReflectionRenderPass()
 
 void CreateMeshMRTPipeline()
 {
+	// The culled scene geometry comes in two streams, see GPUCulling::SurfaceAttributes
 	GFX::VertexBindings vertexBindings = {};
-	vertexBindings.SetBindingPosition(0);
-	vertexBindings.SetBindingType(GFX::BindingType::Vertex);
-	vertexBindings.SetStrideSize(sizeof(Vertex));
-	vertexBindings.AddAttribute(0, offsetof(Vertex, position), GFX::ValueType::Float32x3);
-	vertexBindings.AddAttribute(1, offsetof(Vertex, normal), GFX::ValueType::Float32x3);
-	vertexBindings.AddAttribute(2, offsetof(Vertex, uv), GFX::ValueType::Float32x2);
+	vertexBindings.AddBinding(0, sizeof(glm::vec3), GFX::BindingType::Vertex);
+	vertexBindings.AddAttribute(0, 0, GFX::ValueType::Float32x3);
+	vertexBindings.AddBinding(1, sizeof(GPUCulling::SurfaceAttributes), GFX::BindingType::Vertex);
+	vertexBindings.AddAttribute(1, offsetof(GPUCulling::SurfaceAttributes, normal), s_culling->normalType);
+	vertexBindings.AddAttribute(2, offsetof(GPUCulling::SurfaceAttributes, uv), s_culling->uvType);
 
 	GFX::UniformBindings uniformBindings = {};
 	uniformBindings.AddUniformLayout(s_modelUniform->uniformLayout);
@@ -942,6 +918,37 @@ void CreateMeshMRTPipeline()
 	s_meshMRTPipelineObject->Build(s_meshRenderPass, MRT_PASS_INDEX, 2, vertexBindings, uniformBindings, "screen-space-reflection/default.vert", "screen-space-reflection/defaultMRT.frag", true);
 }
 
+void RecordGBufferBundle()
+{
+	s_gBufferBundle = GFX::BeginRenderBundle(s_meshRenderPass, MRT_PASS_INDEX);
+
+	GFX::ApplyPipeline(s_meshMRTPipelineObject->pipeline);
+
+	// Draw arguments are read when the bundle executes, the culling pass rewrites them every frame
+	GFX::BindUniform(s_waterUniform->uniform, 0);
+	s_culling->Draw(CULL_VIEW_GBUFFER_WATER);
+
+	GFX::BindUniform(s_modelUniform->uniform, 0);
+	s_culling->Draw(CULL_VIEW_GBUFFER_OPAQUE);
+
+	GFX::EndRenderBundle(s_gBufferBundle);
+}
+
+void CreateCulling()
+{
+	// Mesh 1 is the water, drawn with its own material
+	uint32_t cascadeMask = ((1u << SHADOW_MAP_CASCADE_COUNT) - 1u) << CULL_VIEW_SHADOW_CASCADE0;
+
+	std::vector<uint32_t> viewMasks;
+	for (int i = 0; i < s_scene->meshes.size(); i++)
+	{
+		uint32_t gBufferView = i == 1 ? CULL_VIEW_GBUFFER_WATER : CULL_VIEW_GBUFFER_OPAQUE;
+		viewMasks.push_back((1u << gBufferView) | cascadeMask);
+	}
+
+	s_culling = GPUCulling::Create(s_scene, viewMasks);
+}
+
 void CreateGatheringUniformLayout()
 {
 	// Uniform Layout
@@ -1081,7 +1088,8 @@ void ScreenSpaceReflectionExample::Init()
 
 	glm::vec3 minP;
 	glm::vec3 maxP;
-	s_scene = LoadScene("screen-space-reflection/TEST7WithRiver.fbx", minP, maxP);
+	// GPUCulling merges the meshes into its own buffers, per mesh buffers would sit unused
+	s_scene = LoadScene("screen-space-reflection/TEST7WithRiver.fbx", minP, maxP, false);
 
 	target = 0.5f * (minP + maxP);
 	
@@ -1129,7 +1137,10 @@ void ScreenSpaceReflectionExample::Init()
 
 	s_irradianceMap = Skybox::LoadCubeMap(textureNames);
 
+	// The culling owns the merged geometry, the MRT pipeline reads its vertex formats
+	CreateCulling();
 	CreateMeshMRTPipeline();
+	RecordGBufferBundle();
 	CreateGatheringPipeline();
 	CreatePresentPipeline();
 	s_ssrPass = new SSRPass();
@@ -1173,16 +1184,27 @@ void ScreenSpaceReflectionExample::MainLoop()
 		{
 			glm::vec4 lightDir = glm::vec4(glm::normalize(glm::vec3(100.463f, -26.725f, 0.0f)), 0.0f);
 
+			s_shadowMap->ComputeShadowMatrix(s_camera, glm::vec3(lightDir));
+
+			//===========================Culling Pass
+
+			std::array<glm::mat4, CULL_VIEW_COUNT> viewProjections = {};
+			viewProjections[CULL_VIEW_GBUFFER_OPAQUE] = s_camera->GetProjectionMatrix() * s_camera->GetViewMatrix();
+			viewProjections[CULL_VIEW_GBUFFER_WATER] = viewProjections[CULL_VIEW_GBUFFER_OPAQUE];
+			for (uint32_t i = 0; i < SHADOW_MAP_CASCADE_COUNT; i++)
+			{
+				viewProjections[CULL_VIEW_SHADOW_CASCADE0 + i] = s_shadowMap->cascades[i].proj * s_shadowMap->cascades[i].view;
+			}
+
+			s_culling->Cull(viewProjections);
+
 			//===========================Shadow Map Pass
 
-			s_shadowMap->Render(s_scene, target, s_camera, lightDir);
+			s_shadowMap->Render(s_culling);
 
 			//===========================G Buffer Pass
 
-			GFX::BeginRenderPass(s_meshRenderPass, 0, 0, s_width, s_height);
-
-			GFX::SetViewport(0, 0, s_width, s_height);
-			GFX::SetScissor(0, 0, s_width, s_height);
+			GFX::BeginRenderPass(s_meshRenderPass, 0, 0, s_width, s_height, GFX::SubpassContents::SecondaryCommandBuffers);
 
 			UniformBufferObject ubo = {};
 			ubo.view = s_camera->GetViewMatrix();
@@ -1198,33 +1220,16 @@ void ScreenSpaceReflectionExample::MainLoop()
 			GFX::UpdateUniformBuffer(s_waterUniform->uniform, 0, &ubo);
 			GFX::UpdateUniformBuffer(s_gatherUniform, 2, &gatherPassUBO);
 
-			GFX::ApplyPipeline(s_meshMRTPipelineObject->pipeline);
-
-
-			GFX::BindUniform(s_waterUniform->uniform, 0);
-			auto water = s_scene->meshes[1];
-			GFX::BindIndexBuffer(water->indexBuffer, 0, GFX::IndexType::UInt32);
-			GFX::BindVertexBuffer(water->vertexBuffer, 0);
-			GFX::DrawIndexed(water->indices.size(), 1, 0);
-				
-
-			GFX::BindUniform(s_modelUniform->uniform, 0);
-			for (int i = 0; i < s_scene->meshes.size(); i++)
-			{
-				if (i == 1)
-				{
-					continue;
-				}
-
-				auto mesh = s_scene->meshes[i];
-				GFX::BindIndexBuffer(mesh->indexBuffer, 0, GFX::IndexType::UInt32);
-				GFX::BindVertexBuffer(mesh->vertexBuffer, 0);
-				GFX::DrawIndexed(mesh->indices.size(), 1, 0);
-			}
+			GFX::ExecuteRenderBundle(s_gBufferBundle);
 
 			//======================Composite
 
 			GFX::NextSubpass();
+
+			// Dynamic State Is Undefined After Executing The Bundle
+			GFX::SetViewport(0, 0, s_width, s_height);
+			GFX::SetScissor(0, 0, s_width, s_height);
+
 			GFX::ApplyPipeline(skybox->pipeline);
 			// sky box
 			GFX::BindUniform(skybox->uniform, 0);
@@ -1233,9 +1238,9 @@ void ScreenSpaceReflectionExample::MainLoop()
 
 			GFX::ApplyPipeline(s_gatherPipelineObject->pipeline);
 			GFX::BindUniform(s_gatherUniform, 0);
-			GFX::BindUniform(s_shadowMap->uniform0, 1);
-			GFX::BindUniform(s_shadowMap->uniform1, 2);
-			GFX::BindUniform(s_shadowMap->uniform2, 3);
+			GFX::BindUniform(s_shadowMap->uniform, 1, s_shadowMap->cascadeOffsets[0]);
+			GFX::BindUniform(s_shadowMap->uniform, 2, s_shadowMap->cascadeOffsets[1]);
+			GFX::BindUniform(s_shadowMap->uniform, 3, s_shadowMap->cascadeOffsets[2]);
 			GFX::Draw(3, 1, 0, 0);
 
 			//=======================SSR Pass
@@ -1267,6 +1272,9 @@ void ScreenSpaceReflectionExample::MainLoop()
 
 void ScreenSpaceReflectionExample::CleanUp()
 {
+	GFX::DestroyRenderBundle(s_gBufferBundle);
+	delete s_culling;
+
 	delete skybox;
 	DestroyScene(s_scene);
 	delete s_modelUniform;
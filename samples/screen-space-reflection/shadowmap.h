@@ -7,11 +7,15 @@
 #include <glm/gtx/matrix_decompose.hpp>
 #include <glm/gtx/euler_angles.hpp>
 #include <array>
+#include <cstring>
+#include <vector>
 
 #include "string_utils.h"
 #include "mesh.h"
+#include "worker_pool.h"
 
 #include "camera.h"
+#include "gpuculling.h"
 
 #define SHADOW_MAP_CASCADE_COUNT 3
 #define SHADOW_MAP_SIZE 4096
@@ -27,12 +31,7 @@ public:
 		GFX::DestroyShader(vertShader);
 		GFX::DestroyShader(fragShader);
 		GFX::DestroyUniformLayout(uniformLayout);
-		GFX::DestroyUniform(uniform0);
-		GFX::DestroyBuffer(uniformBuffer0);
-		GFX::DestroyUniform(uniform1);
-		GFX::DestroyBuffer(uniformBuffer1);
-		GFX::DestroyUniform(uniform2);
-		GFX::DestroyBuffer(uniformBuffer2);
+		GFX::DestroyUniform(uniform);
 		GFX::DestroyRenderPass(renderPass);
 	}
 
@@ -61,13 +60,6 @@ public:
 		glm::vec4 nothing2;
 	};
 
-	struct Vertex
-	{
-		glm::vec3 position;
-		glm::vec3 normal;
-		glm::vec2 uv;
-	};
-
 	static ShadowMap* Create()
 	{
 		auto result = new ShadowMap();
@@ -202,67 +194,72 @@ public:
 		ubo2.splitPoints = glm::vec4(cascades[0].splitDepth, cascades[1].splitDepth, cascades[2].splitDepth, 2);
 	}
 
-	void Render(Scene* scene, glm::vec3 center, Camera* camera, glm::vec4 lightDir)
+	// Cascade matrices come from ComputeShadowMatrix, culled draw lists from culling
+	void Render(GPUCulling* culling)
 	{
-		GFX::BeginRenderPass(renderPass, 0, 0, SHADOW_MAP_SIZE, SHADOW_MAP_SIZE);
+		UploadCascadeUniforms();
 
-		GFX::SetViewport(0, 0, SHADOW_MAP_SIZE, SHADOW_MAP_SIZE);
-		GFX::SetScissor(0, 0, SHADOW_MAP_SIZE, SHADOW_MAP_SIZE);
+		// Each cascade is recorded on its own worker into a command list for its subpass
+		GFX::Pipeline pipelines[SHADOW_MAP_CASCADE_COUNT] = { pipeline0, pipeline1, pipeline2 };
+		GFX::CommandList commandLists[SHADOW_MAP_CASCADE_COUNT] = {};
+		recorders.Start([this, culling, &pipelines, &commandLists](uint32_t cascade)
+		{
+			commandLists[cascade] = RecordCascade(culling, cascade, pipelines[cascade]);
+		});
 
-		GFX::ApplyPipeline(pipeline0);
+		GFX::BeginRenderPass(renderPass, 0, 0, SHADOW_MAP_SIZE, SHADOW_MAP_SIZE, GFX::SubpassContents::SecondaryCommandBuffers);
 
-		ComputeShadowMatrix(camera, glm::vec3(lightDir));
-		GFX::UpdateUniformBuffer(uniform0, 0, &ubo0);
-		GFX::BindUniform(uniform0, 0);
+		recorders.Wait();
 
-		for (auto mesh : scene->meshes)
+		for (uint32_t i = 0; i < SHADOW_MAP_CASCADE_COUNT; i++)
 		{
-			GFX::BindVertexBuffer(mesh->vertexBuffer, 0);
-			GFX::BindIndexBuffer(mesh->indexBuffer, 0, GFX::IndexType::UInt32);
-			GFX::DrawIndexed(mesh->indices.size(), 1, 0);
+			if (i > 0)
+			{
+				GFX::NextSubpass(GFX::SubpassContents::SecondaryCommandBuffers);
+			}
+
+			GFX::ExecuteCommandLists({ commandLists[i] });
 		}
 
-		GFX::NextSubpass();
-		GFX::ApplyPipeline(pipeline1);
-		
-		GFX::UpdateUniformBuffer(uniform1, 0, &ubo1);
-		GFX::BindUniform(uniform1, 0);
+		GFX::EndRenderPass();
+	}
 
-		for (auto mesh : scene->meshes)
-		{
-			GFX::BindVertexBuffer(mesh->vertexBuffer, 0);
-			GFX::BindIndexBuffer(mesh->indexBuffer, 0, GFX::IndexType::UInt32);
-			GFX::DrawIndexed(mesh->indices.size(), 1, 0);
-		}
+	GFX::CommandList RecordCascade(GPUCulling* culling, uint32_t cascade, GFX::Pipeline pipeline)
+	{
+		GFX::CommandList commandList = GFX::BeginCommandList(renderPass, cascade);
+
+		GFX::SetViewport(0, 0, SHADOW_MAP_SIZE, SHADOW_MAP_SIZE);
+		GFX::SetScissor(0, 0, SHADOW_MAP_SIZE, SHADOW_MAP_SIZE);
 
-		GFX::NextSubpass();
-		GFX::ApplyPipeline(pipeline2);
+		GFX::ApplyPipeline(pipeline);
+		GFX::BindUniform(uniform, 0, cascadeOffsets[cascade]);
 
-		GFX::UpdateUniformBuffer(uniform2, 0, &ubo2);
-		GFX::BindUniform(uniform2, 0);
+		culling->Draw(CULL_VIEW_SHADOW_CASCADE0 + cascade, true);
 
-		for (auto mesh : scene->meshes)
+		GFX::EndCommandList(commandList);
+		return commandList;
+	}
+
+	// Cascade data lives in transient uniform memory, valid for the rest of the frame
+	void UploadCascadeUniforms()
+	{
+		ShadowMapUniformObject* ubos[SHADOW_MAP_CASCADE_COUNT] = { &ubo0, &ubo1, &ubo2 };
+		for (uint32_t i = 0; i < SHADOW_MAP_CASCADE_COUNT; i++)
 		{
-			GFX::BindVertexBuffer(mesh->vertexBuffer, 0);
-			GFX::BindIndexBuffer(mesh->indexBuffer, 0, GFX::IndexType::UInt32);
-			GFX::DrawIndexed(mesh->indices.size(), 1, 0);
+			auto allocation = GFX::AllocateTransientUniform(sizeof(ShadowMapUniformObject));
+			memcpy(allocation.data, ubos[i], sizeof(ShadowMapUniformObject));
+			cascadeOffsets[i] = allocation.offset;
 		}
-
-		GFX::EndRenderPass();
 	}
 
 	ShadowMapUniformObject ubo0 = {};
 	ShadowMapUniformObject ubo1 = {};
 	ShadowMapUniformObject ubo2 = {};
 
-	GFX::Buffer uniformBuffer0 = {};
-	GFX::Buffer uniformBuffer1 = {};
-	GFX::Buffer uniformBuffer2 = {};
-
 	GFX::UniformLayout uniformLayout = {};
-	GFX::Uniform uniform0 = {};
-	GFX::Uniform uniform1 = {};
-	GFX::Uniform uniform2 = {};
+	// One uniform for all cascades, bound with the dynamic offset of each cascade
+	GFX::Uniform uniform = {};
+	uint32_t cascadeOffsets[SHADOW_MAP_CASCADE_COUNT] = {};
 	
 	GFX::Pipeline pipeline0 = {};
 	GFX::Pipeline pipeline1 = {};
@@ -273,6 +270,9 @@ public:
 
 	GFX::RenderPass renderPass = {};
 
+	// One thread per cascade, kept across frames
+	WorkerPool recorders{ SHADOW_MAP_CASCADE_COUNT };
+
 	uint32_t m_width = 0;
 	uint32_t m_height = 0;
 
@@ -296,44 +296,20 @@ private:
 
 	void CreatePipeline()
 	{
-		GFX::BufferDescription uniformBufferDesc = {};
-		uniformBufferDesc.size = sizeof(ShadowMapUniformObject);
-		uniformBufferDesc.storageMode = GFX::BufferStorageMode::Dynamic;
-		uniformBufferDesc.usage = GFX::BufferUsage::UniformBuffer;
-
-		uniformBuffer0 = GFX::CreateBuffer(uniformBufferDesc);
-		uniformBuffer1 = GFX::CreateBuffer(uniformBufferDesc);
-		uniformBuffer2 = GFX::CreateBuffer(uniformBufferDesc);
-
+		// Depth only, positions are read from their own stream
 		GFX::VertexBindings vertexBindings = {};
-		vertexBindings.SetBindingPosition(0);
-		vertexBindings.SetBindingType(GFX::BindingType::Vertex);
-		vertexBindings.SetStrideSize(sizeof(Vertex));
-		vertexBindings.AddAttribute(0, offsetof(Vertex, position), GFX::ValueType::Float32x3);
-		vertexBindings.AddAttribute(1, offsetof(Vertex, normal), GFX::ValueType::Float32x3);
-		vertexBindings.AddAttribute(2, offsetof(Vertex, uv), GFX::ValueType::Float32x2);
+		vertexBindings.AddBinding(0, sizeof(glm::vec3), GFX::BindingType::Vertex);
+		vertexBindings.AddAttribute(0, 0, GFX::ValueType::Float32x3);
 
 		GFX::UniformLayoutDescription uniformLayoutDesc = {};
-		uniformLayoutDesc.AddUniformBinding(0, GFX::UniformType::UniformBuffer, GFX::ShaderStage::VertexFragment, 1);
+		uniformLayoutDesc.AddUniformBinding(0, GFX::UniformType::DynamicUniformBuffer, GFX::ShaderStage::VertexFragment, 1);
 		uniformLayout = GFX::CreateUniformLayout(uniformLayoutDesc);
 
-		GFX::UniformDescription uniformDesc0 = {};
-		uniformDesc0.SetUniformLayout(uniformLayout);
-		uniformDesc0.SetStorageMode(GFX::UniformStorageMode::Dynamic);
-		uniformDesc0.AddBufferAttribute(0, uniformBuffer0, 0, sizeof(ShadowMapUniformObject));
-		uniform0 = GFX::CreateUniform(uniformDesc0);
-
-		GFX::UniformDescription uniformDesc1 = {};
-		uniformDesc1.SetUniformLayout(uniformLayout);
-		uniformDesc1.SetStorageMode(GFX::UniformStorageMode::Dynamic);
-		uniformDesc1.AddBufferAttribute(0, uniformBuffer1, 0, sizeof(ShadowMapUniformObject));
-		uniform1 = GFX::CreateUniform(uniformDesc1);
-
-		GFX::UniformDescription uniformDesc2 = {};
-		uniformDesc2.SetUniformLayout(uniformLayout);
-		uniformDesc2.SetStorageMode(GFX::UniformStorageMode::Dynamic);
-		uniformDesc2.AddBufferAttribute(0, uniformBuffer2, 0, sizeof(ShadowMapUniformObject));
-		uniform2 = GFX::CreateUniform(uniformDesc2);
+		GFX::UniformDescription uniformDesc = {};
+		uniformDesc.SetUniformLayout(uniformLayout);
+		uniformDesc.SetStorageMode(GFX::UniformStorageMode::Static);
+		uniformDesc.AddTransientBufferAttribute(0, sizeof(ShadowMapUniformObject));
+		uniform = GFX::CreateUniform(uniformDesc);
 
 		GFX::UniformBindings uniformBindings = {};
 		uniformBindings.AddUniformLayout(uniformLayout);
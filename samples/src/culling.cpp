@@ -0,0 +1,187 @@
+#include "culling.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define CULLING_AVX 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CULLING_SSE 1
+#endif
+
+namespace Culling
+{
+	// Per plane, the box corner furthest along the normal, picked per axis from the min or max array
+	struct PositiveVertex
+	{
+		const float* x;
+		const float* y;
+		const float* z;
+	};
+
+	static void SelectPositiveVertices(const BoundsSoA& bounds, const Frustum& frustum, PositiveVertex* vertices)
+	{
+		for (uint32_t p = 0; p < 6; p++)
+		{
+			const glm::vec4& plane = frustum.planes[p];
+			vertices[p].x = plane.x >= 0.0f ? bounds.maxX.data() : bounds.minX.data();
+			vertices[p].y = plane.y >= 0.0f ? bounds.maxY.data() : bounds.minY.data();
+			vertices[p].z = plane.z >= 0.0f ? bounds.maxZ.data() : bounds.minZ.data();
+		}
+	}
+
+	void BoundsSoA::Add(const glm::vec3& min, const glm::vec3& max)
+	{
+		minX.push_back(min.x);
+		minY.push_back(min.y);
+		minZ.push_back(min.z);
+		maxX.push_back(max.x);
+		maxY.push_back(max.y);
+		maxZ.push_back(max.z);
+	}
+
+	void BoundsSoA::Clear()
+	{
+		minX.clear();
+		minY.clear();
+		minZ.clear();
+		maxX.clear();
+		maxY.clear();
+		maxZ.clear();
+	}
+
+	size_t BoundsSoA::Size() const
+	{
+		return minX.size();
+	}
+
+	Frustum Frustum::FromViewProjection(const glm::mat4& viewProjection)
+	{
+		// Gribb / Hartmann, rows of the matrix
+		glm::mat4 m = glm::transpose(viewProjection);
+
+		Frustum result = {};
+		result.planes[0] = m[3] + m[0];
+		result.planes[1] = m[3] - m[0];
+		result.planes[2] = m[3] + m[1];
+		result.planes[3] = m[3] - m[1];
+		result.planes[4] = m[2];
+		result.planes[5] = m[3] - m[2];
+
+		for (uint32_t i = 0; i < 6; i++)
+		{
+			result.planes[i] /= glm::length(glm::vec3(result.planes[i]));
+		}
+
+		return result;
+	}
+
+	void CullBoxesScalar(const BoundsSoA& bounds, const Frustum& frustum, size_t first, std::vector<uint32_t>& visible)
+	{
+		PositiveVertex vertices[6];
+		SelectPositiveVertices(bounds, frustum, vertices);
+
+		size_t count = bounds.Size();
+		for (size_t i = first; i < count; i++)
+		{
+			bool inside = true;
+			for (uint32_t p = 0; p < 6 && inside; p++)
+			{
+				const glm::vec4& plane = frustum.planes[p];
+				// Same association as the SIMD paths, so boxes touching a plane are classified the same way
+				float distance = (vertices[p].x[i] * plane.x + vertices[p].y[i] * plane.y) + (vertices[p].z[i] * plane.z + plane.w);
+				inside = distance >= 0.0f;
+			}
+
+			if (inside)
+			{
+				visible.push_back(static_cast<uint32_t>(i));
+			}
+		}
+	}
+
+	void CullBoxes(const BoundsSoA& bounds, const Frustum& frustum, std::vector<uint32_t>& visible)
+	{
+		size_t count = bounds.Size();
+		size_t i = 0;
+
+#if defined(CULLING_AVX) || defined(CULLING_SSE)
+		PositiveVertex vertices[6];
+		SelectPositiveVertices(bounds, frustum, vertices);
+#endif
+
+#if defined(CULLING_AVX)
+		{
+			__m256 zero = _mm256_setzero_ps();
+			__m256 planeX[6], planeY[6], planeZ[6], planeW[6];
+			for (uint32_t p = 0; p < 6; p++)
+			{
+				planeX[p] = _mm256_set1_ps(frustum.planes[p].x);
+				planeY[p] = _mm256_set1_ps(frustum.planes[p].y);
+				planeZ[p] = _mm256_set1_ps(frustum.planes[p].z);
+				planeW[p] = _mm256_set1_ps(frustum.planes[p].w);
+			}
+
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 outside = zero;
+				for (uint32_t p = 0; p < 6; p++)
+				{
+					__m256 distance = _mm256_add_ps(
+						_mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(vertices[p].x + i), planeX[p]), _mm256_mul_ps(_mm256_loadu_ps(vertices[p].y + i), planeY[p])),
+						_mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(vertices[p].z + i), planeZ[p]), planeW[p]));
+					outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, zero, _CMP_LT_OQ));
+				}
+
+				int insideMask = ~_mm256_movemask_ps(outside) & 0xFF;
+				for (uint32_t lane = 0; insideMask != 0; lane++, insideMask >>= 1)
+				{
+					if (insideMask & 1)
+					{
+						visible.push_back(static_cast<uint32_t>(i + lane));
+					}
+				}
+			}
+		}
+#endif
+
+#if defined(CULLING_SSE)
+		{
+			__m128 zero = _mm_setzero_ps();
+			__m128 planeX[6], planeY[6], planeZ[6], planeW[6];
+			for (uint32_t p = 0; p < 6; p++)
+			{
+				planeX[p] = _mm_set1_ps(frustum.planes[p].x);
+				planeY[p] = _mm_set1_ps(frustum.planes[p].y);
+				planeZ[p] = _mm_set1_ps(frustum.planes[p].z);
+				planeW[p] = _mm_set1_ps(frustum.planes[p].w);
+			}
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 outside = zero;
+				for (uint32_t p = 0; p < 6; p++)
+				{
+					__m128 distance = _mm_add_ps(
+						_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(vertices[p].x + i), planeX[p]), _mm_mul_ps(_mm_loadu_ps(vertices[p].y + i), planeY[p])),
+						_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(vertices[p].z + i), planeZ[p]), planeW[p]));
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, zero));
+				}
+
+				int insideMask = ~_mm_movemask_ps(outside) & 0xF;
+				for (uint32_t lane = 0; insideMask != 0; lane++, insideMask >>= 1)
+				{
+					if (insideMask & 1)
+					{
+						visible.push_back(static_cast<uint32_t>(i + lane));
+					}
+				}
+			}
+		}
+#endif
+
+		// Remaining boxes, or all of them without SIMD
+		CullBoxesScalar(bounds, frustum, i, visible);
+	}
+}
@@ -1,12 +1,23 @@
 #include "mesh.h"
+#include "mesh_optimizer.h"
+#include "spdlog/spdlog.h"
 
-Scene* LoadScene(const char* path, glm::vec3& min, glm::vec3& max)
+#include <chrono>
+
+Scene* LoadScene(const char* path, glm::vec3& min, glm::vec3& max, bool createGPUResources)
 {
 	Scene* result = new Scene();
 
+	auto importStart = std::chrono::high_resolution_clock::now();
+
 	Assimp::Importer meshImporter;
 	const aiScene* aiScene = meshImporter.ReadFile(path, aiProcess_OptimizeGraph | aiProcess_OptimizeMeshes);
 
+	auto uploadStart = std::chrono::high_resolution_clock::now();
+
+	// Every Mesh Upload Goes Into One Submission
+	GFX::BeginUploadBatch();
+
 	float minX = INFINITY;
 	float minY = INFINITY;
 	float minZ = INFINITY;
@@ -14,12 +25,19 @@ Scene* LoadScene(const char* path, glm::vec3& min, glm::vec3& max)
 	float maxY = -INFINITY;
 	float maxZ = -INFINITY;
 
+	MeshOptimizer::VertexCacheStatistics cacheBefore = {};
+	MeshOptimizer::VertexCacheStatistics cacheAfter = {};
+	double optimizeMs = 0.0;
+
 	for (int i = 0; i < aiScene->mNumMeshes; i++)
 	{
 		aiMesh* aiMesh = aiScene->mMeshes[i];
 		Mesh* mesh = new Mesh();
 		mesh->name = aiMesh->mName.C_Str();
 
+		glm::vec3 meshMin = glm::vec3(INFINITY);
+		glm::vec3 meshMax = glm::vec3(-INFINITY);
+
 		mesh->indices.resize(aiMesh->mNumFaces * 3);
 		for (size_t f = 0; f < aiMesh->mNumFaces; ++f)
 		{
@@ -51,14 +69,47 @@ Scene* LoadScene(const char* path, glm::vec3& min, glm::vec3& max)
 			maxY = Math::Max(vertex.position.y, maxY);
 			maxZ = Math::Max(vertex.position.z, maxZ);
 
+			meshMin = glm::min(meshMin, vertex.position);
+			meshMax = glm::max(meshMax, vertex.position);
+
 			mesh->vertices.push_back(vertex);
 		}
 
-		mesh->CreateGPUResources();
+		// Weld, reorder for the vertex cache, overdraw and vertex fetch, the bounds stay the same
+		auto optimizeStart = std::chrono::high_resolution_clock::now();
+
+		MeshOptimizer::VertexCacheStatistics meshBefore = {};
+		MeshOptimizer::VertexCacheStatistics meshAfter = {};
+		MeshOptimizer::OptimizeMesh(mesh->vertices, mesh->indices, &meshBefore, &meshAfter);
+		cacheBefore.Accumulate(meshBefore);
+		cacheAfter.Accumulate(meshAfter);
+
+		optimizeMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - optimizeStart).count();
+
+		if (createGPUResources)
+		{
+			mesh->CreateGPUResources();
+		}
+		else
+		{
+			mesh->ChooseIndexType();
+		}
 
 		result->meshes.push_back(mesh);
+		result->bounds.Add(meshMin, meshMax);
 	}
 
+	GFX::UploadTicket uploadTicket = GFX::EndUploadBatch();
+	GFX::WaitUpload(uploadTicket);
+
+	auto loadEnd = std::chrono::high_resolution_clock::now();
+
+	double importMs = std::chrono::duration<double, std::milli>(uploadStart - importStart).count();
+	double uploadMs = std::chrono::duration<double, std::milli>(loadEnd - uploadStart).count() - optimizeMs;
+	spdlog::info("LoadScene {}: {} meshes, import {:.2f} ms, optimize {:.2f} ms, build and upload {:.2f} ms", path, result->meshes.size(), importMs, optimizeMs, uploadMs);
+	spdlog::info("LoadScene {}: vertex cache {}, ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}, vertices {} -> {}", path, VERTEX_CACHE_SIZE,
+		cacheBefore.ACMR(), cacheAfter.ACMR(), cacheBefore.ATVR(), cacheAfter.ATVR(), cacheBefore.vertexCount, cacheAfter.vertexCount);
+
 	min = glm::vec3(minX, minY, minZ);
 	max = glm::vec3(maxX, maxY, maxZ);
 
@@ -0,0 +1,364 @@
+#include "mesh_optimizer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+namespace MeshOptimizer
+{
+	static_assert(sizeof(Vertex) == sizeof(float) * 8, "Vertex must not contain padding, welding compares its bytes");
+
+	struct VertexHasher
+	{
+		size_t operator()(const Vertex& vertex) const
+		{
+			uint32_t words[8];
+			memcpy(words, &vertex, sizeof(words));
+
+			// FNV-1a over the words
+			uint32_t hash = 2166136261u;
+			for (uint32_t i = 0; i < 8; i++)
+			{
+				hash = (hash ^ words[i]) * 16777619u;
+			}
+			return hash;
+		}
+	};
+
+	struct VertexEqual
+	{
+		bool operator()(const Vertex& a, const Vertex& b) const
+		{
+			return memcmp(&a, &b, sizeof(Vertex)) == 0;
+		}
+	};
+
+	float VertexCacheStatistics::ACMR() const
+	{
+		return triangleCount == 0 ? 0.0f : float(misses) / float(triangleCount);
+	}
+
+	float VertexCacheStatistics::ATVR() const
+	{
+		return vertexCount == 0 ? 0.0f : float(misses) / float(vertexCount);
+	}
+
+	void VertexCacheStatistics::Accumulate(const VertexCacheStatistics& other)
+	{
+		misses += other.misses;
+		triangleCount += other.triangleCount;
+		vertexCount += other.vertexCount;
+	}
+
+	VertexCacheStatistics AnalyzeVertexCache(const std::vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize)
+	{
+		VertexCacheStatistics result = {};
+		result.triangleCount = indices.size() / 3;
+		result.vertexCount = vertexCount;
+
+		// A vertex is cached while fewer than cacheSize misses happened after its own
+		std::vector<uint32_t> timestamps(vertexCount, 0);
+		uint32_t time = cacheSize + 1;
+
+		for (auto index : indices)
+		{
+			if (time - timestamps[index] > cacheSize)
+			{
+				timestamps[index] = time++;
+				result.misses++;
+			}
+		}
+
+		return result;
+	}
+
+	size_t WeldVertices(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices)
+	{
+		std::unordered_map<Vertex, uint32_t, VertexHasher, VertexEqual> unique;
+		unique.reserve(vertices.size());
+
+		std::vector<Vertex> welded;
+		welded.reserve(vertices.size());
+
+		std::vector<uint32_t> remap(vertices.size());
+		for (size_t i = 0; i < vertices.size(); i++)
+		{
+			auto inserted = unique.insert(std::make_pair(vertices[i], static_cast<uint32_t>(welded.size())));
+			if (inserted.second)
+			{
+				welded.push_back(vertices[i]);
+			}
+			remap[i] = inserted.first->second;
+		}
+
+		for (auto& index : indices)
+		{
+			index = remap[index];
+		}
+
+		vertices.swap(welded);
+		return vertices.size();
+	}
+
+	void OptimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize)
+	{
+		size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0)
+		{
+			return;
+		}
+
+		// Triangles around each vertex, adjacency[adjacencyOffsets[v]] onwards
+		std::vector<uint32_t> liveTriangles(vertexCount, 0);
+		for (auto index : indices)
+		{
+			liveTriangles[index]++;
+		}
+
+		std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+		for (size_t v = 0; v < vertexCount; v++)
+		{
+			adjacencyOffsets[v + 1] = adjacencyOffsets[v] + liveTriangles[v];
+		}
+
+		std::vector<uint32_t> adjacency(indices.size());
+		std::vector<uint32_t> adjacencyFill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+		for (size_t i = 0; i < indices.size(); i++)
+		{
+			adjacency[adjacencyFill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+		}
+
+		std::vector<uint32_t> timestamps(vertexCount, 0);
+		std::vector<bool> emitted(triangleCount, false);
+		std::vector<uint32_t> deadEnds;
+		std::vector<uint32_t> candidates;
+
+		std::vector<uint32_t> result;
+		result.reserve(indices.size());
+
+		uint32_t time = cacheSize + 1;
+		// Next vertex to try when the dead end stack runs dry
+		size_t cursor = 0;
+
+		auto skipDeadEnd = [&]() -> int64_t
+		{
+			while (!deadEnds.empty())
+			{
+				uint32_t vertex = deadEnds.back();
+				deadEnds.pop_back();
+				if (liveTriangles[vertex] > 0)
+				{
+					return vertex;
+				}
+			}
+
+			for (; cursor < vertexCount; cursor++)
+			{
+				if (liveTriangles[cursor] > 0)
+				{
+					return static_cast<int64_t>(cursor);
+				}
+			}
+
+			return -1;
+		};
+
+		int64_t fanning = skipDeadEnd();
+		while (fanning >= 0)
+		{
+			candidates.clear();
+
+			// Emit every remaining triangle around the fanning vertex
+			for (uint32_t a = adjacencyOffsets[fanning]; a < adjacencyOffsets[fanning + 1]; a++)
+			{
+				uint32_t triangle = adjacency[a];
+				if (emitted[triangle])
+				{
+					continue;
+				}
+
+				for (uint32_t corner = 0; corner < 3; corner++)
+				{
+					uint32_t vertex = indices[triangle * 3 + corner];
+					result.push_back(vertex);
+					deadEnds.push_back(vertex);
+					candidates.push_back(vertex);
+					liveTriangles[vertex]--;
+
+					if (time - timestamps[vertex] > cacheSize)
+					{
+						timestamps[vertex] = time++;
+					}
+				}
+
+				emitted[triangle] = true;
+			}
+
+			// Prefer the oldest candidate that stays in the cache while its own fan is emitted
+			int64_t next = -1;
+			int64_t bestPriority = -1;
+			for (auto vertex : candidates)
+			{
+				if (liveTriangles[vertex] == 0)
+				{
+					continue;
+				}
+
+				int64_t priority = 0;
+				if (time - timestamps[vertex] + 2 * liveTriangles[vertex] <= cacheSize)
+				{
+					priority = time - timestamps[vertex];
+				}
+
+				if (priority > bestPriority)
+				{
+					bestPriority = priority;
+					next = vertex;
+				}
+			}
+
+			fanning = next >= 0 ? next : skipDeadEnd();
+		}
+
+		indices.swap(result);
+	}
+
+	void OptimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices, uint32_t cacheSize)
+	{
+		size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0)
+		{
+			return;
+		}
+
+		// A cluster starts at every triangle whose three vertices miss, reordering there costs no cache hits
+		std::vector<size_t> clusterStarts;
+		std::vector<uint32_t> timestamps(vertices.size(), 0);
+		uint32_t time = cacheSize + 1;
+
+		for (size_t t = 0; t < triangleCount; t++)
+		{
+			uint32_t misses = 0;
+			for (uint32_t corner = 0; corner < 3; corner++)
+			{
+				uint32_t vertex = indices[t * 3 + corner];
+				if (time - timestamps[vertex] > cacheSize)
+				{
+					timestamps[vertex] = time++;
+					misses++;
+				}
+			}
+
+			if (t == 0 || misses == 3)
+			{
+				clusterStarts.push_back(t);
+			}
+		}
+		clusterStarts.push_back(triangleCount);
+
+		size_t clusterCount = clusterStarts.size() - 1;
+		if (clusterCount < 2)
+		{
+			return;
+		}
+
+		// Area weighted centroid and normal of each cluster and of the whole mesh
+		std::vector<glm::vec3> clusterCentroids(clusterCount);
+		std::vector<glm::vec3> clusterNormals(clusterCount);
+		glm::vec3 meshCentroid = glm::vec3(0.0f);
+		float meshArea = 0.0f;
+
+		for (size_t c = 0; c < clusterCount; c++)
+		{
+			glm::vec3 centroid = glm::vec3(0.0f);
+			glm::vec3 normal = glm::vec3(0.0f);
+			float area = 0.0f;
+
+			for (size_t t = clusterStarts[c]; t < clusterStarts[c + 1]; t++)
+			{
+				const glm::vec3& p0 = vertices[indices[t * 3 + 0]].position;
+				const glm::vec3& p1 = vertices[indices[t * 3 + 1]].position;
+				const glm::vec3& p2 = vertices[indices[t * 3 + 2]].position;
+
+				glm::vec3 cross = glm::cross(p1 - p0, p2 - p0);
+				float triangleArea = glm::length(cross);
+
+				centroid += (p0 + p1 + p2) * (triangleArea / 3.0f);
+				normal += cross;
+				area += triangleArea;
+			}
+
+			meshCentroid += centroid;
+			meshArea += area;
+
+			clusterCentroids[c] = area > 0.0f ? centroid / area : centroid;
+			clusterNormals[c] = normal;
+		}
+
+		if (meshArea > 0.0f)
+		{
+			meshCentroid /= meshArea;
+		}
+
+		// Clusters facing away from the middle of the mesh tend to occlude the others, draw them first
+		std::vector<float> scores(clusterCount);
+		std::vector<uint32_t> order(clusterCount);
+		for (size_t c = 0; c < clusterCount; c++)
+		{
+			float normalLength = glm::length(clusterNormals[c]);
+			scores[c] = normalLength > 0.0f ? glm::dot(clusterCentroids[c] - meshCentroid, clusterNormals[c] / normalLength) : 0.0f;
+			order[c] = static_cast<uint32_t>(c);
+		}
+
+		std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return scores[a] > scores[b]; });
+
+		std::vector<uint32_t> result;
+		result.reserve(indices.size());
+		for (auto c : order)
+		{
+			result.insert(result.end(), indices.begin() + clusterStarts[c] * 3, indices.begin() + clusterStarts[c + 1] * 3);
+		}
+
+		indices.swap(result);
+	}
+
+	size_t OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices)
+	{
+		const uint32_t unused = ~0u;
+		std::vector<uint32_t> remap(vertices.size(), unused);
+
+		std::vector<Vertex> result;
+		result.reserve(vertices.size());
+
+		for (auto& index : indices)
+		{
+			if (remap[index] == unused)
+			{
+				remap[index] = static_cast<uint32_t>(result.size());
+				result.push_back(vertices[index]);
+			}
+			index = remap[index];
+		}
+
+		vertices.swap(result);
+		return vertices.size();
+	}
+
+	void OptimizeMesh(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices, VertexCacheStatistics* before, VertexCacheStatistics* after)
+	{
+		if (before)
+		{
+			*before = AnalyzeVertexCache(indices, vertices.size());
+		}
+
+		WeldVertices(vertices, indices);
+		OptimizeVertexCache(indices, vertices.size());
+		OptimizeOverdraw(indices, vertices);
+		OptimizeVertexFetch(vertices, indices);
+
+		if (after)
+		{
+			*after = AnalyzeVertexCache(indices, vertices.size());
+		}
+	}
+}
@@ -0,0 +1,200 @@
+#include "quantize.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define QUANTIZE_SSE 1
+#endif
+
+namespace Quantize
+{
+	// Written like _mm_max_ps / _mm_min_ps so NaN handling matches the SIMD path
+	static float Clamp(float value, float min, float max)
+	{
+		value = value > min ? value : min;
+		return value < max ? value : max;
+	}
+
+	static int32_t RoundToInt(float value)
+	{
+		return static_cast<int32_t>(value + std::copysign(0.5f, value));
+	}
+
+	uint16_t FloatToHalf(float value)
+	{
+		uint32_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+
+		uint32_t sign = (bits >> 16) & 0x8000;
+		uint32_t magnitude = bits & 0x7FFFFFFF;
+
+		// Rebias the exponent from 127 to 15 and round the 13 dropped mantissa bits
+		uint32_t half = (magnitude - (112u << 23) + (1u << 12)) >> 13;
+		// Below the smallest normal half
+		half = magnitude < (113u << 23) ? 0 : half;
+		// Would round to infinity, clamp to the largest finite half
+		half = magnitude >= (143u << 23) - (1u << 12) ? 0x7BFF : half;
+		half = magnitude > (255u << 23) ? 0x7E00 : half;
+
+		return static_cast<uint16_t>(sign | half);
+	}
+
+	uint32_t PackSNorm10x3(const glm::vec3& value)
+	{
+		uint32_t x = RoundToInt(Clamp(value.x, -1.0f, 1.0f) * 511.0f) & 0x3FF;
+		uint32_t y = RoundToInt(Clamp(value.y, -1.0f, 1.0f) * 511.0f) & 0x3FF;
+		uint32_t z = RoundToInt(Clamp(value.z, -1.0f, 1.0f) * 511.0f) & 0x3FF;
+
+		return x | (y << 10) | (z << 20);
+	}
+
+#if defined(QUANTIZE_SSE)
+	static __m128i FloatToHalf4(__m128 value)
+	{
+		__m128i bits = _mm_castps_si128(value);
+		__m128i sign = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+		__m128i magnitude = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+
+		__m128i half = _mm_srli_epi32(_mm_add_epi32(magnitude, _mm_set1_epi32((1 << 12) - (112 << 23))), 13);
+
+		// Magnitudes fit in 31 bits, the signed compares are safe
+		__m128i underflow = _mm_cmplt_epi32(magnitude, _mm_set1_epi32(113 << 23));
+		__m128i overflow = _mm_cmpgt_epi32(magnitude, _mm_set1_epi32((143 << 23) - (1 << 12) - 1));
+		__m128i nan = _mm_cmpgt_epi32(magnitude, _mm_set1_epi32(255 << 23));
+
+		half = _mm_andnot_si128(underflow, half);
+		half = _mm_or_si128(_mm_andnot_si128(overflow, half), _mm_and_si128(overflow, _mm_set1_epi32(0x7BFF)));
+		half = _mm_or_si128(_mm_andnot_si128(nan, half), _mm_and_si128(nan, _mm_set1_epi32(0x7E00)));
+
+		return _mm_or_si128(half, sign);
+	}
+
+	// Clamp, scale and round half away from zero, the same steps as Clamp and RoundToInt
+	static __m128i FloatToNorm4(__m128 value, float min, float scale)
+	{
+		__m128 clamped = _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(min)), _mm_set1_ps(1.0f));
+		__m128 scaled = _mm_mul_ps(clamped, _mm_set1_ps(scale));
+		__m128 rounding = _mm_or_ps(_mm_and_ps(scaled, _mm_castsi128_ps(_mm_set1_epi32(0x80000000))), _mm_set1_ps(0.5f));
+
+		return _mm_cvttps_epi32(_mm_add_ps(scaled, rounding));
+	}
+#endif
+
+	void FloatToHalf(const float* src, uint16_t* dst, size_t count)
+	{
+		size_t i = 0;
+
+#if defined(QUANTIZE_SSE)
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i half = FloatToHalf4(_mm_loadu_ps(src + i));
+			// Sign extend so the saturating pack keeps the 16 bits as they are
+			half = _mm_srai_epi32(_mm_slli_epi32(half, 16), 16);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(half, half));
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			dst[i] = FloatToHalf(src[i]);
+		}
+	}
+
+	void FloatToSNorm8(const float* src, int8_t* dst, size_t count)
+	{
+		size_t i = 0;
+
+#if defined(QUANTIZE_SSE)
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i values = FloatToNorm4(_mm_loadu_ps(src + i), -1.0f, 127.0f);
+			values = _mm_packs_epi32(values, values);
+			values = _mm_packs_epi16(values, values);
+
+			int32_t packed = _mm_cvtsi128_si32(values);
+			memcpy(dst + i, &packed, sizeof(packed));
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			dst[i] = static_cast<int8_t>(RoundToInt(Clamp(src[i], -1.0f, 1.0f) * 127.0f));
+		}
+	}
+
+	void FloatToSNorm16(const float* src, int16_t* dst, size_t count)
+	{
+		size_t i = 0;
+
+#if defined(QUANTIZE_SSE)
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i values = FloatToNorm4(_mm_loadu_ps(src + i), -1.0f, 32767.0f);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(values, values));
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			dst[i] = static_cast<int16_t>(RoundToInt(Clamp(src[i], -1.0f, 1.0f) * 32767.0f));
+		}
+	}
+
+	void FloatToUNorm8(const float* src, uint8_t* dst, size_t count)
+	{
+		size_t i = 0;
+
+#if defined(QUANTIZE_SSE)
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i values = FloatToNorm4(_mm_loadu_ps(src + i), 0.0f, 255.0f);
+			values = _mm_packs_epi32(values, values);
+			values = _mm_packus_epi16(values, values);
+
+			int32_t packed = _mm_cvtsi128_si32(values);
+			memcpy(dst + i, &packed, sizeof(packed));
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			dst[i] = static_cast<uint8_t>(RoundToInt(Clamp(src[i], 0.0f, 1.0f) * 255.0f));
+		}
+	}
+
+	void QuantizeNormals(const glm::vec3* normals, size_t count, GFX::ValueType type, uint32_t* dst)
+	{
+		if (type == GFX::ValueType::A2B10G10R10SNorm)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				dst[i] = PackSNorm10x3(normals[i]);
+			}
+			return;
+		}
+
+		assert(type == GFX::ValueType::SNorm8x4);
+
+		// Pad to four components so each normal lands in one uint32_t
+		std::vector<float> padded(count * 4);
+		for (size_t i = 0; i < count; i++)
+		{
+			padded[i * 4 + 0] = normals[i].x;
+			padded[i * 4 + 1] = normals[i].y;
+			padded[i * 4 + 2] = normals[i].z;
+			padded[i * 4 + 3] = 0.0f;
+		}
+
+		FloatToSNorm8(padded.data(), reinterpret_cast<int8_t*>(dst), padded.size());
+	}
+
+	void QuantizeTexCoords(const glm::vec2* texCoords, size_t count, uint16_t* dst)
+	{
+		static_assert(sizeof(glm::vec2) == sizeof(float) * 2, "glm::vec2 must be tightly packed");
+		FloatToHalf(reinterpret_cast<const float*>(texCoords), dst, count * 2);
+	}
+}
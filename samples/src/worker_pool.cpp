@@ -0,0 +1,78 @@
+#include "worker_pool.h"
+
+#include <cassert>
+
+WorkerPool::WorkerPool(uint32_t threadCount)
+{
+	for (uint32_t i = 0; i < threadCount; i++)
+	{
+		m_threads.push_back(std::thread(&WorkerPool::Run, this, i));
+	}
+}
+
+WorkerPool::~WorkerPool()
+{
+	Wait();
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_exit = true;
+	}
+	m_wake.notify_all();
+
+	for (auto& thread : m_threads)
+	{
+		thread.join();
+	}
+}
+
+void WorkerPool::Start(const std::function<void(uint32_t)>& job)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		assert(m_pending == 0);
+
+		m_job = job;
+		m_pending = static_cast<uint32_t>(m_threads.size());
+		m_generation++;
+	}
+	m_wake.notify_all();
+}
+
+void WorkerPool::Wait()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_done.wait(lock, [this]() { return m_pending == 0; });
+}
+
+uint32_t WorkerPool::ThreadCount() const
+{
+	return static_cast<uint32_t>(m_threads.size());
+}
+
+void WorkerPool::Run(uint32_t workerIndex)
+{
+	uint64_t seenGeneration = 0;
+	while (true)
+	{
+		std::function<void(uint32_t)> job;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wake.wait(lock, [&]() { return m_exit || m_generation != seenGeneration; });
+			if (m_exit)
+			{
+				return;
+			}
+			seenGeneration = m_generation;
+			job = m_job;
+		}
+
+		job(workerIndex);
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_pending--;
+		}
+		m_done.notify_one();
+	}
+}
@@ -10,11 +10,19 @@
 
 #include <shaderc/shaderc.hpp>
 
+#define VMA_IMPLEMENTATION
+#include "vk_mem_alloc.h"
+
 #include <map>
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <functional>
 #include <sstream>
 #include <fstream>
 #include <assert.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 #define VK_ASSERT(resultObj) assert(resultObj.result == vk::Result::eSuccess)
 
@@ -32,6 +40,7 @@ namespace GFX
     struct UniformResource;
     struct ImageResource;
     struct SamplerResource;
+    struct RenderBundleResource;
     struct AttachmentResource;
 
     /*
@@ -41,14 +50,15 @@ namespace GFX
     /*
     Handle Pools
     */
-    static HandlePool<PipelineResource> s_pipelineHandlePool = HandlePool<PipelineResource>(200);
-    static HandlePool<ShaderResource> s_shaderHandlePool = HandlePool<ShaderResource>(200);
-    static HandlePool<RenderPassResource> s_renderPassHandlePool = HandlePool<RenderPassResource>(200);
-    static HandlePool<BufferResource> s_bufferHandlePool = HandlePool<BufferResource>(512);
-    static HandlePool<UniformLayoutResource> s_uniformLayoutHandlePool = HandlePool<UniformLayoutResource>(128);
-    static HandlePool<UniformResource> s_uniformHandlePool = HandlePool<UniformResource>(256);
-    static HandlePool<ImageResource> s_imageHandlePool = HandlePool<ImageResource>(256);
-    static HandlePool<SamplerResource> s_samplerHandlePool = HandlePool<SamplerResource>(256);
+    static HandlePool<PipelineResource> s_pipelineHandlePool(200);
+    static HandlePool<ShaderResource> s_shaderHandlePool(200);
+    static HandlePool<RenderPassResource> s_renderPassHandlePool(200);
+    static HandlePool<BufferResource> s_bufferHandlePool(512);
+    static HandlePool<UniformLayoutResource> s_uniformLayoutHandlePool(128);
+    static HandlePool<UniformResource> s_uniformHandlePool(256);
+    static HandlePool<ImageResource> s_imageHandlePool(256);
+    static HandlePool<SamplerResource> s_samplerHandlePool(256);
+    static HandlePool<RenderBundleResource> s_renderBundleHandlePool(64);
 
     /*
     Device Instance
@@ -61,6 +71,37 @@ namespace GFX
 
     static ktxVulkanDeviceInfo s_ktx_device_info;
 
+    /*
+    Memory Allocator
+    */
+    enum class MemoryPool
+    {
+        // Device Local Vertex, Index And Static Uniform Buffers
+        StaticGeometry = 0,
+        // Host Coherent Buffers Rewritten By CPU Every Frame
+        DynamicUniform,
+        // Host Visible Upload Buffers
+        Staging,
+        // Attachments And Device Local Color / Depth Images
+        RenderTarget,
+        // No Custom Pool, Allocated From VMA Default Pools
+        Default
+    };
+
+    const uint32_t MEMORY_POOL_COUNT = static_cast<uint32_t>(MemoryPool::Default);
+
+    static const vk::DeviceSize s_memoryPoolBlockSizes[MEMORY_POOL_COUNT] =
+    {
+        64ull * 1024 * 1024,
+        16ull * 1024 * 1024,
+        32ull * 1024 * 1024,
+        128ull * 1024 * 1024
+    };
+
+    static VmaAllocator s_allocator = nullptr;
+    static VmaPool s_memoryPools[MEMORY_POOL_COUNT] = {};
+    static uint32_t s_memoryPoolTypeIndices[MEMORY_POOL_COUNT] = {};
+
     static VkSurfaceKHR s_surface = nullptr;
 
     /*
@@ -74,11 +115,14 @@ namespace GFX
     */
     static uint32_t s_graphicsFamily;
     static uint32_t s_presentFamily;
+    // Transfer Only Family When The Device Has One, Otherwise Same As s_graphicsFamily
+    static uint32_t s_transferFamily;
     /*
     Default Queue
     */
     static vk::Queue s_graphicsQueueDefault = nullptr;
     static vk::Queue s_presentQueueDefault = nullptr;
+    static vk::Queue s_transferQueueDefault = nullptr;
     /*
     Swap Chain
     */
@@ -108,11 +152,10 @@ namespace GFX
 
     uint32_t s_currentImageIndex = 0;
     uint32_t s_currentFrame = 0;
-
-    /*
-    Current Pipeline
-    */
-    PipelineResource* s_currentPipleline = nullptr;
+    // Between BeginFrame And EndFrame, Dynamic Uniform Writes Only Touch The Current Slot
+    bool s_frameRecording = false;
+    // Between BeginRenderPass And EndRenderPass, Dispatches And Barriers Are Not Allowed
+    bool s_insideRenderPass = false;
 
     /*
     Swap Chain Frame Buffers
@@ -130,14 +173,83 @@ namespace GFX
     std::vector<vk::CommandBuffer> s_commandBuffersDefault;
 
     /*
-    Default Descriptor Pool
+    Bindless
+    One update-after-bind set, binding 0 holds every sampled image, binding 1 every sampler.
+    Indices are recycled only after deferred deletion, so frames in flight never see them reused.
     */
-    vk::DescriptorPool s_descriptorPoolDefault = nullptr;
+    const uint32_t BINDLESS_IMAGE_CAPACITY = 16384;
+    const uint32_t BINDLESS_SAMPLER_CAPACITY = 1024;
+    const uint32_t BINDLESS_INVALID_INDEX = ~0u;
+
+    static bool s_bindlessEnabled = false;
+    static vk::DescriptorPool s_bindlessDescriptorPool = nullptr;
+    static vk::DescriptorSetLayout s_bindlessDescriptorSetLayout = nullptr;
+    static vk::DescriptorSet s_bindlessDescriptorSet = nullptr;
+    static UniformLayout s_bindlessUniformLayout;
+
+    static uint32_t s_bindlessImageCount = 0;
+    static std::vector<uint32_t> s_bindlessImageFreeIndices;
+    static uint32_t s_bindlessSamplerCount = 0;
+    static std::vector<uint32_t> s_bindlessSamplerFreeIndices;
 
     /*
     Current Descriptor Set
+    Sets requested by BindUniform, only the dirty range is bound at the next draw.
     */
-    std::map<uint32_t, vk::DescriptorSet> s_currentDescriptors;
+    const uint32_t MAX_DESCRIPTOR_SETS = 8;
+    const uint32_t MAX_DYNAMIC_OFFSETS_PER_SET = 8;
+
+    struct DescriptorSetBinding
+    {
+        vk::DescriptorSet descriptorSet = nullptr;
+        uint32_t dynamicOffsetCount = 0;
+        uint32_t dynamicOffsets[MAX_DYNAMIC_OFFSETS_PER_SET] = {};
+    };
+
+    /*
+    Command Context
+    Recording state of one command buffer, the frame's primary buffer on the main thread or a command list on a worker.
+    */
+    const uint32_t MAX_VERTEX_BINDINGS = 16;
+
+    struct VertexBufferBinding
+    {
+        vk::Buffer buffer = nullptr;
+        vk::DeviceSize offset = 0;
+    };
+
+    struct CommandContext
+    {
+        vk::CommandBuffer commandBuffer = nullptr;
+        PipelineResource* pipeline = nullptr;
+
+        // Shadow Of The State Last Recorded, Binds Matching It Are Dropped
+        vk::Pipeline boundPipeline = nullptr;
+        VertexBufferBinding vertexBuffers[MAX_VERTEX_BINDINGS];
+        vk::Buffer indexBuffer = nullptr;
+        vk::DeviceSize indexBufferOffset = 0;
+        vk::IndexType indexType = vk::IndexType::eUint32;
+        bool viewportValid = false;
+        vk::Viewport viewport;
+        bool scissorValid = false;
+        vk::Rect2D scissor;
+
+        DescriptorSetBinding descriptors[MAX_DESCRIPTOR_SETS];
+        // Dirty Range Is [dirtySetBegin, dirtySetEnd), Empty When Begin >= End
+        uint32_t dirtySetBegin = MAX_DESCRIPTOR_SETS;
+        uint32_t dirtySetEnd = 0;
+
+        // Set Index The Bindless Set Is Bound At Until Recording Ends, -1 When Not Bound
+        int32_t bindlessSetIndex = -1;
+
+        RenderStatistics statistics;
+    };
+
+    static CommandContext s_frameContext;
+    // Context Of The Command List The Calling Thread Records, Null Selects The Frame's Primary Buffer
+    static thread_local CommandContext* s_threadContext = nullptr;
+
+    static RenderStatistics s_lastFrameRenderStatistics;
 
     /*
     Sync Objects
@@ -148,6 +260,185 @@ namespace GFX
     std::vector<vk::Semaphore> s_renderFinishedSemaphores;
     std::vector<vk::Fence> s_inFlightFences;
 
+    /*
+    Descriptor Allocator
+    Pools are chained, when every pool of a chain is exhausted a new one is created, sized from the demand observed so far.
+    Persistent sets are freed one by one, transient sets live in per-frame chains that are reset wholesale.
+    */
+    struct DescriptorPoolChain
+    {
+        std::vector<vk::DescriptorPool> pools;
+        // Pool Tried First, The Last One That Served An Allocation
+        size_t current = 0;
+        bool freeable = false;
+
+        // Live Descriptors Per Type And The Peak Seen, New Pools Are Sized From The Peak
+        std::map<vk::DescriptorType, uint32_t> usage;
+        std::map<vk::DescriptorType, uint32_t> peakUsage;
+        uint32_t setCount = 0;
+        uint32_t peakSetCount = 0;
+    };
+
+    const uint32_t DESCRIPTOR_POOL_MIN_SETS = 256;
+
+    static DescriptorPoolChain s_persistentDescriptorPools;
+    static DescriptorPoolChain s_transientDescriptorPools[MAX_FRAMES_IN_FLIGHT];
+    // Transient Uniforms Released When Their Frame Slot Comes Around Again
+    static std::vector<uint32_t> s_transientUniforms[MAX_FRAMES_IN_FLIGHT];
+
+    /*
+    Command Lists
+    Every recording thread owns one command pool per frame in flight, reset in BeginFrame once that frame's fence has signaled.
+    */
+    struct ThreadCommandPool
+    {
+        vk::CommandPool commandPools[MAX_FRAMES_IN_FLIGHT];
+        std::vector<vk::CommandBuffer> commandBuffers[MAX_FRAMES_IN_FLIGHT];
+        uint32_t usedCommandBuffers[MAX_FRAMES_IN_FLIGHT] = {};
+
+        // A Thread Records One Command List At A Time
+        CommandContext context;
+        uint32_t recordingList = 0;
+    };
+
+    struct CommandListRecord
+    {
+        vk::CommandBuffer commandBuffer = nullptr;
+        RenderStatistics statistics;
+        bool ended = false;
+    };
+
+    static std::mutex s_commandListMutex;
+    static std::vector<ThreadCommandPool*> s_threadCommandPools;
+    // Pools Left Behind By Exited Threads, Handed To The Next Thread That Records
+    static std::vector<ThreadCommandPool*> s_freeThreadCommandPools;
+    // Lists Of The Frame Being Recorded, CommandList::id Is The Index Plus One
+    static std::vector<CommandListRecord> s_commandLists;
+    // Bumped When Shutdown Destroys The Pools, Owners From An Older Epoch Hold Dangling Pointers
+    static uint32_t s_threadCommandPoolEpoch = 0;
+
+    struct ThreadCommandPoolOwner
+    {
+        ~ThreadCommandPoolOwner()
+        {
+            std::lock_guard<std::mutex> lock(s_commandListMutex);
+            if (pool && epoch == s_threadCommandPoolEpoch)
+            {
+                s_freeThreadCommandPools.push_back(pool);
+            }
+        }
+
+        ThreadCommandPool* pool = nullptr;
+        uint32_t epoch = 0;
+    };
+
+    static thread_local ThreadCommandPoolOwner s_threadCommandPool;
+
+    /*
+    Render Bundles
+    Recorded from the main thread only, the pool is created with the first bundle that is executed.
+    */
+    static vk::CommandPool s_renderBundleCommandPool = nullptr;
+    static std::vector<uint32_t> s_renderBundles;
+    // Bundle Capturing The Recording Calls Made On This Thread, Null When Recording Normally
+    static thread_local RenderBundleResource* s_recordingBundle = nullptr;
+
+    /*
+    Deferred Destruction
+    Objects released while frame N is recorded are destroyed once frame N's in flight fence has signaled
+    */
+    struct DeferredDeletion
+    {
+        uint64_t frame;
+        std::function<void()> destroy;
+    };
+
+    uint64_t s_frameCount = 0;
+    std::deque<DeferredDeletion> s_deferredDeletions;
+
+    /*
+    Uploads
+    Static buffer and image uploads suballocate from one persistently mapped staging ring.
+    Ring space is handed back when the fence of the submission that consumed it signals.
+    */
+    struct StagingRegion
+    {
+        vk::Buffer buffer = nullptr;
+        vk::DeviceSize offset = 0;
+        void* mappedPtr = nullptr;
+    };
+
+    enum class UploadQueue
+    {
+        // Dedicated Transfer Queue, Resources Are Released To The Graphics Family Afterwards
+        Transfer = 0,
+        // Graphics Queue, Used Without A Transfer Family Or For Resources Graphics Already Owns
+        Graphics = 1
+    };
+
+    struct UploadSubmission
+    {
+        UploadQueue queue = UploadQueue::Graphics;
+        vk::CommandBuffer commandBuffer = nullptr;
+        vk::Fence fence = nullptr;
+        // Consumed Upload Semaphore, Reusable Once The Fence Signals
+        vk::Semaphore waitSemaphore = nullptr;
+        // Ring Head At Submit Time, Everything Before It Is Free Once The Fence Signals
+        uint64_t ringEnd = 0;
+        // Submission Order, Backs Upload Tickets
+        uint64_t serial = 0;
+        // One Off Staging Buffers For Uploads Larger Than The Ring
+        std::vector<vk::Buffer> oversizedBuffers;
+        std::vector<VmaAllocation> oversizedAllocations;
+    };
+
+    const vk::DeviceSize STAGING_RING_SIZE = 32ull * 1024 * 1024;
+    const vk::DeviceSize STAGING_BUFFER_ALIGNMENT = 16;
+    // Multiple Of Every Texel Size We Support, Including 3 Component Formats
+    const vk::DeviceSize STAGING_IMAGE_ALIGNMENT = 48;
+
+    static vk::Buffer s_stagingRingBuffer = nullptr;
+    static VmaAllocation s_stagingRingAllocation = nullptr;
+    static uint8_t* s_stagingRingMappedPtr = nullptr;
+    // Monotonic Byte Counters, Ring Position Is Counter % STAGING_RING_SIZE
+    static uint64_t s_stagingRingHead = 0;
+    static uint64_t s_stagingRingTail = 0;
+
+    static vk::CommandPool s_uploadCommandPools[2] = {};
+    // Submission Being Recorded, commandBuffer Is Null When Nothing Is Recorded
+    static UploadSubmission s_currentUpload;
+    static std::deque<UploadSubmission> s_pendingUploads;
+    static std::vector<UploadSubmission> s_freeUploads[2];
+
+    /*
+    Queue Family Ownership
+    Transfer queue submissions signal a semaphore, each one waits on the previous, so at most one is unconsumed.
+    The next graphics submission waits on it and runs the matching acquire barriers first.
+    */
+    static vk::Semaphore s_pendingUploadSemaphore = nullptr;
+    static std::vector<vk::Semaphore> s_freeUploadSemaphores;
+    static std::vector<vk::Semaphore> s_frameUploadSemaphores;
+    static std::vector<vk::CommandBuffer> s_acquireCommandBuffers;
+    static std::vector<vk::BufferMemoryBarrier> s_pendingAcquireBufferBarriers;
+    static std::vector<vk::ImageMemoryBarrier> s_pendingAcquireImageBarriers;
+
+    // Uploads Are Only Submitted When The Outermost Batch Ends
+    static uint32_t s_uploadBatchDepth = 0;
+    static uint64_t s_uploadSubmittedSerial = 0;
+    static uint64_t s_uploadCompletedSerial = 0;
+
+    /*
+    Transient Uniforms
+    One persistently mapped buffer split into a region per frame in flight.
+    A region is rewound once the fence of its frame signals, allocations are bound by dynamic offset.
+    */
+    const vk::DeviceSize TRANSIENT_UNIFORM_REGION_SIZE = 4ull * 1024 * 1024;
+
+    static vk::Buffer s_transientUniformBuffer = nullptr;
+    static VmaAllocation s_transientUniformAllocation = nullptr;
+    static uint8_t* s_transientUniformMappedPtr = nullptr;
+    static vk::DeviceSize s_transientUniformHead = 0;
+
     /*
     Extension And Layer Info
     */
@@ -162,6 +453,15 @@ namespace GFX
 
     vk::PhysicalDeviceRayTracingPropertiesKHR s_rayTracingProperties;
 
+    // Enabled Together With The Raytracing Extension
+    static bool s_bufferDeviceAddressEnabled = false;
+
+    // Vulkan 1.2 drawIndirectCount, Enabled Whenever The Device Supports It
+    static bool s_drawIndirectCountEnabled = false;
+
+    // Core multiDrawIndirect, Enabled With The Other Supported Core Features
+    static bool s_multiDrawIndirectEnabled = false;
+
     /*
     =============================================Internal Interface Declaration====================================================
     */
@@ -184,14 +484,61 @@ namespace GFX
     // void CreateSwapChainFramebuffers();
     void CreateCommandPoolDefault();
     void CreateCommandBuffersDefault();
-    void CreateDescriptorPoolDefault();
+    void CreateDescriptorAllocators();
+    void DestroyDescriptorAllocators();
+    void ResetTransientDescriptorPools(uint32_t frame);
+    vk::DescriptorPool CreateDescriptorPool(const DescriptorPoolChain& chain, const std::map<vk::DescriptorType, uint32_t>& request, uint32_t requestSetCount);
+    vk::DescriptorPool AllocateDescriptorSets(DescriptorPoolChain& chain, UniformLayoutResource* layout, uint32_t setCount, std::vector<vk::DescriptorSet>& descriptorSets);
+    void ReleaseDescriptorSets(DescriptorPoolChain& chain, const std::map<vk::DescriptorType, uint32_t>& descriptorCounts, uint32_t setCount);
     void CreateSyncObjects();
 
+    void DeferDeletion(std::function<void()> destroy);
+    void RefreshUniformAttachments(uint32_t uniformHandle, uint32_t renderPassHandle);
+    void ProcessDeferredDeletions();
+
+    void CreateUploadResources();
+    void DestroyUploadResources();
+    void CreateTransientUniformResources();
+    void DestroyTransientUniformResources();
+    void CreateBindlessResources();
+    void DestroyBindlessResources();
+    uint32_t AllocateBindlessIndex(uint32_t& count, std::vector<uint32_t>& freeIndices, uint32_t capacity);
+    void WriteBindlessImage(uint32_t index, vk::ImageView imageView, vk::ImageLayout layout);
+    void WriteBindlessSampler(uint32_t index, vk::Sampler sampler);
+    CommandContext& GetCommandContext();
+    uint32_t GetCompatibleSetCount(const PipelineResource* previous, const PipelineResource* next);
+    bool IsPushConstantRangeDeclared(const PipelineResource* pipeline, vk::ShaderStageFlags stages, uint32_t offset, uint32_t size);
+    void SetDescriptorSet(CommandContext& context, uint32_t set, vk::DescriptorSet descriptorSet, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount);
+    void FlushDescriptorSets(CommandContext& context);
+    void AccumulateRenderStatistics(RenderStatistics& target, const RenderStatistics& source);
+    ThreadCommandPool* GetThreadCommandPool();
+    void ResetThreadCommandPools(uint32_t frame);
+    void DestroyThreadCommandPools();
+    void ResetBoundState(CommandContext& context);
+    void RecordRenderBundle(RenderBundleResource* bundle);
+    void InvalidateRenderBundles(uint32_t handle, std::vector<uint32_t> RenderBundleResource::* dependencies);
+    void DestroyRenderBundleResources();
+    UploadQueue ChooseUploadQueue(bool graphicsOwned);
+    StagingRegion AllocateStaging(vk::DeviceSize size, vk::DeviceSize alignment, UploadQueue queue);
+    vk::CommandBuffer GetUploadCommandBuffer(UploadQueue queue);
+    void RecordBufferOwnershipRelease(vk::CommandBuffer cb, vk::Buffer buffer, vk::DeviceSize offset, vk::DeviceSize size);
+    void RecordImageOwnershipRelease(vk::CommandBuffer cb, vk::Image image, uint32_t layerCount);
+    bool RecordPendingAcquires(vk::CommandBuffer cb);
+    vk::Semaphore AcquireUploadSemaphore();
+    void SubmitPendingAcquires();
+    void SubmitUploads();
+    void FinishUpload();
+    void RetireUploads();
+    void WaitOldestUpload();
+
     vk::CommandBuffer BeginOneTimeCommandBuffer();
     void EndOneTimeCommandBuffer(vk::CommandBuffer commandBuffer);
 
     vk::Format MapTypeFormatForVulkan(ValueType valueType);
     vk::IndexType MapIndexTypeFormatForVulkan(IndexType indexType);
+    vk::SubpassContents MapSubpassContentsForVulkan(SubpassContents contents);
+    vk::AccessFlags MapAcessForVulkan(const Access& access);
+    vk::PipelineStageFlags MapPipelineStageForVulkan(const PipelineStage& pipelineStage);
     vk::ShaderStageFlags MapShaderStageForVulkan(const ShaderStage& stage);
     vk::ShaderStageFlagBits MapSingleShaderStageForVulkan(const ShaderStage& stage);
     vk::DescriptorType MapUniformTypeForVulkan(const UniformType& uniformType);
@@ -208,10 +555,20 @@ namespace GFX
     vk::Format FindDepthFormat();
     bool HasStencilComponent(vk::Format format);
 
-    void CreateVulkanBuffer(size_t size, vk::BufferUsageFlags usage, vk::MemoryPropertyFlags properties, vk::Buffer& buffer, vk::DeviceMemory& bufferMemory);
+    void CreateMemoryPools();
+    void DestroyMemoryPools();
+    VmaMemoryUsage MapMemoryPoolUsageForVma(MemoryPool pool);
+    vk::MemoryPropertyFlags MapMemoryPoolPropertiesForVulkan(MemoryPool pool);
+    VmaAllocationCreateInfo MakeAllocationCreateInfo(MemoryPool pool, const vk::MemoryRequirements& memRequirements, vk::MemoryPropertyFlags properties);
+
+    void CreateVulkanBuffer(size_t size, vk::BufferUsageFlags usage, vk::MemoryPropertyFlags properties, MemoryPool pool, vk::Buffer& buffer, VmaAllocation& allocation);
+    void DestroyVulkanBuffer(vk::Buffer buffer, VmaAllocation allocation);
+    void CreateVulkanBufferWithDeviceAddress(size_t size, vk::BufferUsageFlags usage, vk::MemoryPropertyFlags properties, vk::Buffer& buffer, vk::DeviceMemory& deviceMemory);
     void TransitionImageLayout(vk::Image img, vk::Format format, vk::ImageLayout oldLayout, vk::ImageLayout newLayout, uint32_t layerCount);
-    void CopyBufferToImage(vk::Buffer buffer, vk::Image img, uint32_t width, uint32_t height, uint32_t layerCount);
-    void CreateVulkanImage(uint32_t width, uint32_t height, vk::Format format, vk::ImageTiling tiling, vk::ImageUsageFlags usage, vk::MemoryPropertyFlags properties, vk::Image& image, vk::DeviceMemory& imageMemory);
+    void RecordImageLayoutTransition(vk::CommandBuffer cb, vk::Image img, vk::Format format, vk::ImageLayout oldLayout, vk::ImageLayout newLayout, uint32_t layerCount);
+    void RecordCopyBufferToImage(vk::CommandBuffer cb, vk::Buffer buffer, vk::DeviceSize bufferOffset, vk::Image img, uint32_t width, uint32_t height, uint32_t layerCount);
+    void CreateVulkanImage(uint32_t width, uint32_t height, vk::Format format, vk::ImageTiling tiling, vk::ImageUsageFlags usage, vk::MemoryPropertyFlags properties, MemoryPool pool, vk::Image& image, VmaAllocation& allocation);
+    void DestroyVulkanImage(vk::Image image, VmaAllocation allocation);
     vk::ImageView CreateVulkanImageView(vk::Image image, vk::Format format, vk::ImageAspectFlags aspect, vk::ImageViewType type, uint32_t layerCount, uint32_t levelCount);
 
     uint32_t HashTwoInt(uint32_t a, uint32_t b);
@@ -224,7 +581,7 @@ namespace GFX
         bool isSwapChain = false;
         vk::Format m_format;
         vk::ImageUsageFlags m_usage;
-        vk::DeviceMemory m_memory;
+        VmaAllocation m_allocation = nullptr;
         vk::ImageView m_imageView;
         vk::Image m_image;
         vk::ImageLayout m_finalLayout;
@@ -369,7 +726,11 @@ namespace GFX
 
             DestroyFramebuffers();
 
-            s_device.destroyRenderPass(m_renderPass);
+            vk::RenderPass renderPass = m_renderPass;
+            DeferDeletion([renderPass]()
+            {
+                s_device.destroyRenderPass(renderPass);
+            });
         }
 
         void Resize(int width, int height)
@@ -389,6 +750,12 @@ namespace GFX
 
             DestroyFramebuffers();
             CreateFramebuffers();
+
+            // Submitted Frames Keep Reading The Old Sets, Each Uniform Moves To Fresh Ones So Nothing Waits On The GPU
+            for (auto uniformHandle : m_dependentUniforms)
+            {
+                RefreshUniformAttachments(uniformHandle, handle);
+            }
         }
 
         void CreateFramebuffers()
@@ -426,10 +793,15 @@ namespace GFX
 
         void DestroyFramebuffers()
         {
-            for (int i = 0; i < s_swapChainImages.size(); i++)
+            std::vector<vk::Framebuffer> framebuffers = m_framebuffers;
+            DeferDeletion([framebuffers]()
             {
-                s_device.destroyFramebuffer(m_framebuffers[i]);
-            }
+                for (auto framebuffer : framebuffers)
+                {
+                    s_device.destroyFramebuffer(framebuffer);
+                }
+            });
+            m_framebuffers.clear();
         }
 
         AttachmentResource GetSwapChainAttachment(uint32_t imageIndex)
@@ -449,7 +821,7 @@ namespace GFX
             result.m_format = format;
             result.m_usage = usage;
 
-            CreateVulkanImage(width, height, format, vk::ImageTiling::eOptimal, usage | vk::ImageUsageFlagBits::eInputAttachment | vk::ImageUsageFlagBits::eSampled, vk::MemoryPropertyFlagBits::eDeviceLocal, result.m_image, result.m_memory);
+            CreateVulkanImage(width, height, format, vk::ImageTiling::eOptimal, usage | vk::ImageUsageFlagBits::eInputAttachment | vk::ImageUsageFlagBits::eSampled, vk::MemoryPropertyFlagBits::eDeviceLocal, MemoryPool::RenderTarget, result.m_image, result.m_allocation);
 
             if (usage & vk::ImageUsageFlagBits::eColorAttachment)
             {
@@ -480,7 +852,7 @@ namespace GFX
 
             if (!result.isSwapChain)
             {
-                CreateVulkanImage(width, height, oldAttachment.m_format, vk::ImageTiling::eOptimal, oldAttachment.m_usage | vk::ImageUsageFlagBits::eInputAttachment | vk::ImageUsageFlagBits::eSampled, vk::MemoryPropertyFlagBits::eDeviceLocal, result.m_image, result.m_memory);
+                CreateVulkanImage(width, height, oldAttachment.m_format, vk::ImageTiling::eOptimal, oldAttachment.m_usage | vk::ImageUsageFlagBits::eInputAttachment | vk::ImageUsageFlagBits::eSampled, vk::MemoryPropertyFlagBits::eDeviceLocal, MemoryPool::RenderTarget, result.m_image, result.m_allocation);
                 if (oldAttachment.m_usage & vk::ImageUsageFlagBits::eColorAttachment)
                 {
                     result.m_imageView = CreateVulkanImageView(result.m_image, oldAttachment.m_format, vk::ImageAspectFlagBits::eColor, vk::ImageViewType::e2D, 1, 1);
@@ -508,51 +880,14 @@ namespace GFX
                 return;
             }
 
-            s_device.waitIdle();
-
-            s_device.destroyImageView(attachment.m_imageView);
-            s_device.destroyImage(attachment.m_image);
-            s_device.freeMemory(attachment.m_memory);
-        }
-
-        vk::AccessFlags MapAcessForVulkan(const Access& access)
-        {
-            switch (access)
-            {
-            case Access::ColorAttachmentWrite:
-                return vk::AccessFlagBits::eColorAttachmentWrite;
-            case Access::ShaderRead:
-                return vk::AccessFlagBits::eShaderRead;
-            case Access::InputAttachmentRead:
-                return vk::AccessFlagBits::eInputAttachmentRead;
-            case Access::DepthStencilAttachmentWrite:
-                return vk::AccessFlagBits::eDepthStencilAttachmentWrite;
-            default:
-                assert(false);
-                return vk::AccessFlagBits::eShaderRead;
-            }
-        }
-
-        vk::PipelineStageFlags MapPipelineStageForVulkan(const PipelineStage& pipelineStage)
-        {
-            switch (pipelineStage)
+            vk::ImageView imageView = attachment.m_imageView;
+            vk::Image image = attachment.m_image;
+            VmaAllocation allocation = attachment.m_allocation;
+            DeferDeletion([imageView, image, allocation]()
             {
-            case PipelineStage::ColorAttachmentOutput:
-                return vk::PipelineStageFlagBits::eColorAttachmentOutput;
-            case PipelineStage::FragmentShader:
-                return vk::PipelineStageFlagBits::eFragmentShader;
-            case PipelineStage::VertexShader:
-                return vk::PipelineStageFlagBits::eVertexShader;
-            case PipelineStage::EarlyFragmentTests:
-                return vk::PipelineStageFlagBits::eEarlyFragmentTests;
-            case PipelineStage::LateFragmentTests:
-                return vk::PipelineStageFlagBits::eLateFragmentTests;
-            case PipelineStage::All:
-                return vk::PipelineStageFlagBits::eAllCommands;
-            default:
-                assert(false);
-                return vk::PipelineStageFlagBits::eAllCommands;
-            }
+                s_device.destroyImageView(imageView);
+                DestroyVulkanImage(image, allocation);
+            });
         }
 
         vk::PipelineBindPoint MapPipelineBindPointForVulkan(const PipelineType& pipelineType)
@@ -639,6 +974,8 @@ namespace GFX
         uint32_t m_height;
        
         uint32_t handle = 0;
+        // Uniforms Sampling Or Reading Attachments Of This Pass, Given New Descriptor Sets On Resize
+        std::vector<uint32_t> m_dependentUniforms;
     };
 
     struct ShaderResource
@@ -781,6 +1118,13 @@ namespace GFX
                 layoutBinding.setDescriptorType(MapUniformTypeForVulkan(uniformDesc.type));
 
                 descriptorSetLayoutBindings.push_back(layoutBinding);
+
+                m_descriptorTypes[uniformDesc.binding] = layoutBinding.descriptorType;
+                m_descriptorCounts[layoutBinding.descriptorType] += uniformDesc.count;
+                if (uniformDesc.type == UniformType::DynamicUniformBuffer)
+                {
+                    m_dynamicBindingCount += uniformDesc.count;
+                }
             }
 
             vk::DescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo = {};
@@ -792,13 +1136,29 @@ namespace GFX
             m_descriptorSetLayout = createDescriptorSetLayoutResult.value;
         }
 
+        // Wraps A Layout Created Elsewhere, Such As The Bindless One, Which Keeps Ownership
+        UniformLayoutResource(vk::DescriptorSetLayout descriptorSetLayout)
+        {
+            m_descriptorSetLayout = descriptorSetLayout;
+            m_ownsLayout = false;
+        }
+
         ~UniformLayoutResource()
         {
-            s_device.destroyDescriptorSetLayout(m_descriptorSetLayout);
+            if (m_ownsLayout)
+            {
+                s_device.destroyDescriptorSetLayout(m_descriptorSetLayout);
+            }
         }
 
         uint32_t handle = 0;
         vk::DescriptorSetLayout m_descriptorSetLayout = nullptr;
+        std::map<uint32_t, vk::DescriptorType> m_descriptorTypes;
+        // Descriptors Per Type One Set Of This Layout Takes From A Pool
+        std::map<vk::DescriptorType, uint32_t> m_descriptorCounts;
+        // Number Of Dynamic Offsets A Set Of This Layout Consumes When Bound
+        uint32_t m_dynamicBindingCount = 0;
+        bool m_ownsLayout = true;
     };
 
     struct PipelineResource
@@ -814,12 +1174,12 @@ namespace GFX
                 shaderStageCreateInfos.push_back(shaderResource->GetShaderStageCreateInfo());
             }
 
-            auto bindingDesc = CreateBindingDescription(desc.vertexBindings);
+            auto bindingDescs = CreateBindingDescriptions(desc.vertexBindings);
             auto attributeDescs = CreateVertexInputAttributeDescriptions(desc.vertexBindings);
 
             vk::PipelineVertexInputStateCreateInfo vertexInputStateCreateInfo = {};
-            vertexInputStateCreateInfo.setVertexBindingDescriptionCount(1);
-            vertexInputStateCreateInfo.setPVertexBindingDescriptions(&bindingDesc);
+            vertexInputStateCreateInfo.setVertexBindingDescriptionCount(bindingDescs.size());
+            vertexInputStateCreateInfo.setPVertexBindingDescriptions(bindingDescs.data());
 
             vertexInputStateCreateInfo.setVertexAttributeDescriptionCount(attributeDescs.size());
             vertexInputStateCreateInfo.setPVertexAttributeDescriptions(attributeDescs.data());
@@ -902,22 +1262,7 @@ namespace GFX
             dynamicStateCreateInfo.setDynamicStateCount(dynamicStates.size());
             dynamicStateCreateInfo.setPDynamicStates(dynamicStates.data());
             
-            /*
-            Pipeline Layout
-            */
-            m_descriptorSetLayouts.resize(desc.uniformBindings.m_layouts.size());
-            for (size_t i = 0; i < m_descriptorSetLayouts.size(); i++)
-            {
-                m_descriptorSetLayouts[i] = s_uniformLayoutHandlePool.FetchResource(desc.uniformBindings.m_layouts[i].id)->m_descriptorSetLayout;
-            }
-
-            vk::PipelineLayoutCreateInfo layoutCreateInfo = {};
-            layoutCreateInfo.setPSetLayouts(m_descriptorSetLayouts.data());
-            layoutCreateInfo.setSetLayoutCount(m_descriptorSetLayouts.size());
-
-            auto createPipelineLayoutResult = s_device.createPipelineLayout(layoutCreateInfo);
-            VK_ASSERT(createPipelineLayoutResult);
-            m_pipelineLayout = createPipelineLayoutResult.value;
+            CreatePipelineLayout(desc.uniformBindings, desc.pushConstantRanges);
 
             vk::GraphicsPipelineCreateInfo pipelineCreateInfo = {};
             pipelineCreateInfo.setStageCount(shaderStageCreateInfos.size());
@@ -940,22 +1285,87 @@ namespace GFX
             m_pipeline = createGraphicsPipelineResult.value;
         }
 
+        PipelineResource(const ComputePipelineDescription& desc)
+        {
+            ShaderResource* shaderResource = s_shaderHandlePool.FetchResource(desc.shader.id);
+            assert(shaderResource->m_shaderStage == ShaderStage::Compute);
+
+            CreatePipelineLayout(desc.uniformBindings, desc.pushConstantRanges);
+
+            vk::ComputePipelineCreateInfo pipelineCreateInfo = {};
+            pipelineCreateInfo.setStage(shaderResource->GetShaderStageCreateInfo());
+            pipelineCreateInfo.setLayout(m_pipelineLayout);
+
+            auto createComputePipelineResult = s_device.createComputePipeline(nullptr, pipelineCreateInfo);
+            VK_ASSERT(createComputePipelineResult);
+            m_pipeline = createComputePipelineResult.value;
+            m_bindPoint = vk::PipelineBindPoint::eCompute;
+        }
+
         ~PipelineResource()
         {
-            s_device.waitIdle();
+            vk::PipelineLayout pipelineLayout = m_pipelineLayout;
+            vk::Pipeline pipeline = m_pipeline;
+            DeferDeletion([pipelineLayout, pipeline]()
+            {
+                s_device.destroyPipelineLayout(pipelineLayout);
+                s_device.destroyPipeline(pipeline);
+            });
+        }
+
+        void CreatePipelineLayout(const UniformBindings& uniformBindings, const std::vector<PushConstantRange>& ranges)
+        {
+            m_descriptorSetLayouts.resize(uniformBindings.m_layouts.size());
+            for (size_t i = 0; i < m_descriptorSetLayouts.size(); i++)
+            {
+                m_descriptorSetLayouts[i] = s_uniformLayoutHandlePool.FetchResource(uniformBindings.m_layouts[i].id)->m_descriptorSetLayout;
+            }
+
+            std::vector<vk::PushConstantRange> pushConstantRanges;
+            for (auto range : ranges)
+            {
+                vk::PushConstantRange pushConstantRange = {};
+                pushConstantRange.setStageFlags(MapShaderStageForVulkan(range.stage));
+                pushConstantRange.setOffset(range.offset);
+                pushConstantRange.setSize(range.size);
+                pushConstantRanges.push_back(pushConstantRange);
+            }
+            m_pushConstantRanges = pushConstantRanges;
+
+            vk::PipelineLayoutCreateInfo layoutCreateInfo = {};
+            layoutCreateInfo.setPSetLayouts(m_descriptorSetLayouts.data());
+            layoutCreateInfo.setSetLayoutCount(m_descriptorSetLayouts.size());
+            layoutCreateInfo.setPPushConstantRanges(pushConstantRanges.data());
+            layoutCreateInfo.setPushConstantRangeCount(pushConstantRanges.size());
 
-            s_device.destroyPipelineLayout(m_pipelineLayout);
-            s_device.destroyPipeline(m_pipeline);
+            auto createPipelineLayoutResult = s_device.createPipelineLayout(layoutCreateInfo);
+            VK_ASSERT(createPipelineLayoutResult);
+            m_pipelineLayout = createPipelineLayoutResult.value;
         }
 
-        vk::VertexInputBindingDescription CreateBindingDescription(const VertexBindings& bindings)
+        std::vector<vk::VertexInputBindingDescription> CreateBindingDescriptions(const VertexBindings& bindings)
         {
-            vk::VertexInputBindingDescription vertexInputBindingDescription = {};
-            vertexInputBindingDescription.setBinding(0);
-            vertexInputBindingDescription.setInputRate(MapBindingTypeForVulkan(bindings.m_bindingType));
-            vertexInputBindingDescription.setStride(bindings.m_strideSize);
+            std::vector<vk::VertexInputBindingDescription> results = {};
+            for (size_t i = 0; i < bindings.m_bindings.size(); i++)
+            {
+                auto bindingInfo = bindings.m_bindings[i];
+                assert(bindingInfo.position < MAX_VERTEX_BINDINGS);
+
+                // Each Binding Position Describes One Stream
+                for (size_t j = 0; j < i; j++)
+                {
+                    assert(bindings.m_bindings[j].position != bindingInfo.position);
+                }
 
-            return vertexInputBindingDescription;
+                vk::VertexInputBindingDescription vertexInputBindingDescription = {};
+                vertexInputBindingDescription.setBinding(bindingInfo.position);
+                vertexInputBindingDescription.setInputRate(MapBindingTypeForVulkan(bindingInfo.bindingType));
+                vertexInputBindingDescription.setStride(bindingInfo.strideSize);
+
+                results.push_back(vertexInputBindingDescription);
+            }
+
+            return results;
         }
 
         std::vector<vk::VertexInputAttributeDescription> CreateVertexInputAttributeDescriptions(const VertexBindings& bindings)
@@ -964,8 +1374,10 @@ namespace GFX
             for (size_t i = 0; i < bindings.m_layout.size(); i++)
             {
                 auto attributeInfo = bindings.m_layout[i];
+                assert(attributeInfo.bindingIndex < bindings.m_bindings.size());
+
                 vk::VertexInputAttributeDescription attributeDesc = {};
-                attributeDesc.setBinding(bindings.m_bindingPosition);
+                attributeDesc.setBinding(bindings.m_bindings[attributeInfo.bindingIndex].position);
                 attributeDesc.setFormat(MapTypeFormatForVulkan(attributeInfo.type));
                 attributeDesc.setLocation(attributeInfo.location);
                 attributeDesc.setOffset(attributeInfo.offset);
@@ -1036,7 +1448,9 @@ namespace GFX
         uint32_t handle = 0;
         vk::Pipeline m_pipeline = nullptr;
         vk::PipelineLayout m_pipelineLayout = nullptr;
+        vk::PipelineBindPoint m_bindPoint = vk::PipelineBindPoint::eGraphics;
         std::vector<vk::DescriptorSetLayout> m_descriptorSetLayouts;
+        std::vector<vk::PushConstantRange> m_pushConstantRanges;
     };
 
     struct BufferResource
@@ -1047,40 +1461,79 @@ namespace GFX
             m_storageMode = desc.storageMode;
             m_usage = desc.usage;
 
+            size_t actualSize = m_size;
+            vk::BufferUsageFlags usage = MapBufferUsageForVulkan(desc.usage);
+            vk::MemoryPropertyFlags memoryProperties = vk::MemoryPropertyFlagBits::eDeviceLocal;
+            MemoryPool memoryPool = MemoryPool::StaticGeometry;
+
             // If Dynamic, No Staging Buffer, Use Host Visible Buffer
             if (desc.storageMode == BufferStorageMode::Dynamic)
             {
-                size_t actualSize = m_size;
-                
-                // Uniform Buffer With Dynamic Storage Mode
+                // Uniform Buffer With Dynamic Storage Mode, One Slot Per Swap Chain Image
                 if (desc.usage == BufferUsage::UniformBuffer)
                 {
-                    actualSize = s_swapChainImages.size() * m_size;
+                    m_slotCount = s_swapChainImages.size();
+                    actualSize = m_slotCount * m_size;
                 }
 
-                CreateVulkanBuffer(
-                    actualSize,
-                    MapBufferUsageForVulkan(desc.usage),
-                    vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent, 
-                    m_buffer, 
-                    m_deviceMemory);
+                memoryProperties = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
+                memoryPool = MemoryPool::DynamicUniform;
             }
             else if (desc.storageMode == BufferStorageMode::Static)
             {
-                CreateVulkanBuffer(
-                    desc.size, 
-                    vk::BufferUsageFlagBits::eTransferDst | MapBufferUsageForVulkan(desc.usage), 
-                    vk::MemoryPropertyFlagBits::eDeviceLocal, 
-                    m_buffer, 
-                    m_deviceMemory);
+                usage |= vk::BufferUsageFlagBits::eTransferDst;
+            }
+
+            if (desc.deviceAddress)
+            {
+                CreateVulkanBufferWithDeviceAddress(actualSize, usage, memoryProperties, m_buffer, m_deviceMemory);
+            }
+            else
+            {
+                CreateVulkanBuffer(actualSize, usage, memoryProperties, memoryPool, m_buffer, m_allocation);
+            }
+
+            if (desc.storageMode == BufferStorageMode::Dynamic)
+            {
+                // Mapped For The Whole Lifetime, Host Coherent So Writes Need No Flush
+                void* mappedData = nullptr;
+                if (m_deviceMemory)
+                {
+                    auto mapMemoryResult = s_device.mapMemory(m_deviceMemory, 0, VK_WHOLE_SIZE);
+                    VK_ASSERT(mapMemoryResult);
+                    mappedData = mapMemoryResult.value;
+                }
+                else
+                {
+                    VkResult mapResult = vmaMapMemory(s_allocator, m_allocation, &mappedData);
+                    assert(mapResult == VK_SUCCESS);
+                }
+                m_persistentPtr = static_cast<uint8_t*>(mappedData);
             }
         }
 
         ~BufferResource()
         {
-            s_device.waitIdle();
-            s_device.destroyBuffer(m_buffer);
-            s_device.freeMemory(m_deviceMemory);
+            vk::Buffer buffer = m_buffer;
+            VmaAllocation allocation = m_allocation;
+            vk::DeviceMemory deviceMemory = m_deviceMemory;
+            bool mapped = m_persistentPtr != nullptr;
+            DeferDeletion([buffer, allocation, deviceMemory, mapped]()
+            {
+                // Freeing Device Memory Also Unmaps It
+                if (deviceMemory)
+                {
+                    s_device.destroyBuffer(buffer);
+                    s_device.freeMemory(deviceMemory);
+                    return;
+                }
+
+                if (mapped)
+                {
+                    vmaUnmapMemory(s_allocator, allocation);
+                }
+                DestroyVulkanBuffer(buffer, allocation);
+            });
         }
 
         vk::BufferUsageFlags MapBufferUsageForVulkan(const BufferUsage& usage)
@@ -1095,87 +1548,99 @@ namespace GFX
                 return vk::BufferUsageFlagBits::eIndexBuffer;
             case BufferUsage::TransferBuffer:
                 return vk::BufferUsageFlagBits::eTransferSrc;
+            case BufferUsage::StorageBuffer:
+                return vk::BufferUsageFlagBits::eStorageBuffer;
+            case BufferUsage::IndirectBuffer:
+                return vk::BufferUsageFlagBits::eIndirectBuffer | vk::BufferUsageFlagBits::eStorageBuffer;
             }
         }
 
         void Update(size_t offset, size_t size, void* data)
         {
-            if (m_usage == BufferUsage::UniformBuffer)
+            if (m_storageMode == BufferStorageMode::Dynamic)
             {
-                if (m_storageMode == BufferStorageMode::Dynamic)
+                assert(offset + size <= m_size);
+
+                // Outside A Frame No Slot Is Known To Be Next, Fill Them All
+                if (m_slotCount > 1 && !s_frameRecording)
                 {
-                    for (int i = 0; i < s_swapChainImages.size(); i++)
+                    for (size_t i = 0; i < m_slotCount; i++)
                     {
-                        Map(offset + (i * m_size), size);
-                        memcpy(m_mappedPtr, data, size);
-                        Unmap();
+                        memcpy(m_persistentPtr + i * m_size + offset, data, size);
                     }
-                    return;
                 }
                 else
                 {
-                    Map(offset, size);
+                    memcpy(GetCurrentSlotPointer() + offset, data, size);
                 }
+                return;
             }
-            else
-            {
-                Map(offset, size);
-            }
+
+            Map(offset, size);
             memcpy(m_mappedPtr, data, size);
             Unmap();
         }
 
-        void Map(size_t offset, size_t size)
+        uint8_t* GetCurrentSlotPointer() const
+        {
+            // Slot Matches The Descriptor Set Bound For The Current Swap Chain Image
+            size_t slot = m_slotCount > 1 ? s_currentImageIndex : 0;
+            return m_persistentPtr + slot * m_size;
+        }
+
+        void* Map(size_t offset, size_t size)
         {
             if (m_storageMode == BufferStorageMode::Dynamic)
             {
-                auto mapMemoryResult = s_device.mapMemory(m_deviceMemory, offset, size);
-                VK_ASSERT(mapMemoryResult);
-                m_mappedPtr = mapMemoryResult.value;
+                assert(offset + size <= m_size);
+                m_mappedPtr = GetCurrentSlotPointer() + offset;
             }
             else
             {
                 m_mappedSize = size;
                 m_mappedOffset = offset;
 
-                CreateVulkanBuffer(
-                    m_size,
-                    vk::BufferUsageFlagBits::eTransferSrc,
-                    vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent,
-                    m_stagingBuffer,
-                    m_stagingDeviceMemory);
+                m_uploadQueue = ChooseUploadQueue(m_graphicsOwned);
 
-                auto mapMemoryResult = s_device.mapMemory(m_stagingDeviceMemory, offset, size);
-                VK_ASSERT(mapMemoryResult);
-                m_mappedPtr = mapMemoryResult.value;
+                StagingRegion staging = AllocateStaging(size, STAGING_BUFFER_ALIGNMENT, m_uploadQueue);
+                m_stagingBuffer = staging.buffer;
+                m_stagingOffset = staging.offset;
+                m_mappedPtr = staging.mappedPtr;
             }
+
+            return m_mappedPtr;
         }
 
         void Unmap()
         {
             if (m_storageMode == BufferStorageMode::Dynamic)
             {
-                s_device.unmapMemory(m_deviceMemory);
+                // Persistently Mapped And Host Coherent, Nothing To Do
+                m_mappedPtr = nullptr;
             }
             else
             {
-                // Unmap First
-                s_device.unmapMemory(m_stagingDeviceMemory);
-                // Copy To device memory
-                auto oneTimeCommandBuffer = BeginOneTimeCommandBuffer();
+                // Copy To device memory, Staging Region Is Recycled By The Upload Fence
+                auto uploadCommandBuffer = GetUploadCommandBuffer(m_uploadQueue);
 
                 vk::BufferCopy bufferCopy = {};
                 bufferCopy.setSize(m_mappedSize);
                 bufferCopy.setDstOffset(m_mappedOffset);
-                bufferCopy.setSrcOffset(0);
+                bufferCopy.setSrcOffset(m_stagingOffset);
 
-                oneTimeCommandBuffer.copyBuffer(m_stagingBuffer, m_buffer, bufferCopy);
+                uploadCommandBuffer.copyBuffer(m_stagingBuffer, m_buffer, bufferCopy);
+
+                if (m_uploadQueue == UploadQueue::Transfer)
+                {
+                    RecordBufferOwnershipRelease(uploadCommandBuffer, m_buffer, m_mappedOffset, m_mappedSize);
+                }
+                // Later Uploads Go Through The Graphics Queue, Which Owns The Buffer From Now On
+                m_graphicsOwned = true;
 
-                EndOneTimeCommandBuffer(oneTimeCommandBuffer);
+                FinishUpload();
 
-                // Clear Stage Buffer
-                s_device.destroyBuffer(m_stagingBuffer);
-                s_device.freeMemory(m_stagingDeviceMemory);
+                m_stagingBuffer = nullptr;
+                m_mappedPtr = nullptr;
             }
         }
 
@@ -1195,11 +1660,19 @@ namespace GFX
         size_t m_mappedSize = 0;
         size_t m_mappedOffset = 0;
 
+        // Dynamic Storage Mode Only
+        uint8_t* m_persistentPtr = nullptr;
+        size_t m_slotCount = 1;
+
         size_t m_size = 0;
         vk::Buffer m_buffer = nullptr;
+        VmaAllocation m_allocation = nullptr;
+        // Device Address Buffers Only, VMA Can Not Request The Device Address Allocation Flag
         vk::DeviceMemory m_deviceMemory = nullptr;
         vk::Buffer m_stagingBuffer = nullptr;
-        vk::DeviceMemory m_stagingDeviceMemory = nullptr;
+        vk::DeviceSize m_stagingOffset = 0;
+        UploadQueue m_uploadQueue = UploadQueue::Graphics;
+        bool m_graphicsOwned = false;
         BufferStorageMode m_storageMode = BufferStorageMode::Dynamic;
         BufferUsage m_usage;
     };
@@ -1247,12 +1720,22 @@ namespace GFX
 
         ~SamplerResource()
         {
-            s_device.waitIdle();
-            s_device.destroySampler(m_sampler);
+            vk::Sampler sampler = m_sampler;
+            uint32_t bindlessIndex = m_bindlessIndex;
+            DeferDeletion([sampler, bindlessIndex]()
+            {
+                s_device.destroySampler(sampler);
+
+                if (bindlessIndex != BINDLESS_INVALID_INDEX)
+                {
+                    s_bindlessSamplerFreeIndices.push_back(bindlessIndex);
+                }
+            });
         }
         
         uint32_t handle = 0;
         vk::Sampler m_sampler;
+        uint32_t m_bindlessIndex = BINDLESS_INVALID_INDEX;
     };
 
     struct ImageResource
@@ -1314,24 +1797,34 @@ namespace GFX
             vk::MemoryRequirements memRequirements = s_device.getImageMemoryRequirements(m_image);
             m_memSize = memRequirements.size;
 
-            vk::MemoryAllocateInfo memAllocInfo = {};
-            memAllocInfo.setAllocationSize(memRequirements.size);
-            if (!desc.readOrWriteByCPU)
+            vk::MemoryPropertyFlags memoryProperties = vk::MemoryPropertyFlagBits::eDeviceLocal;
+            MemoryPool memoryPool = MemoryPool::Default;
+            if (desc.readOrWriteByCPU)
             {
-                memAllocInfo.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, vk::MemoryPropertyFlagBits::eDeviceLocal);
+                memoryProperties = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
             }
-            else
+            else if (desc.usage != ImageUsage::SampledImage)
             {
-                memAllocInfo.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, vk::MemoryPropertyFlagBits::eHostVisible|vk::MemoryPropertyFlagBits::eHostCoherent);
+                memoryPool = MemoryPool::RenderTarget;
             }
 
-            auto allocateMemoryResult = s_device.allocateMemory(memAllocInfo);
-            VK_ASSERT(allocateMemoryResult);
-            m_deviceMemory = allocateMemoryResult.value;
+            VmaAllocationCreateInfo allocCreateInfo = MakeAllocationCreateInfo(memoryPool, memRequirements, memoryProperties);
+            VkResult allocResult = vmaAllocateMemoryForImage(s_allocator, m_image, &allocCreateInfo, &m_allocation, nullptr);
+            assert(allocResult == VK_SUCCESS);
 
-            s_device.bindImageMemory(m_image, m_deviceMemory, 0);
+            VkResult bindResult = vmaBindImageMemory(s_allocator, m_allocation, m_image);
+            assert(bindResult == VK_SUCCESS);
 
             m_imageView = CreateVulkanImageView(m_image, m_format, vk::ImageAspectFlagBits::eColor, MapImageViewTypeForVulkan(m_type), m_layerCount, 1);
+
+            // Storage Images Stay In General Layout For Their Whole Lifetime
+            if (desc.usage == ImageUsage::StorageImage)
+            {
+                auto cb = GetUploadCommandBuffer(UploadQueue::Graphics);
+                RecordImageLayoutTransition(cb, m_image, m_format, vk::ImageLayout::eUndefined, vk::ImageLayout::eGeneral, m_layerCount);
+                m_graphicsOwned = true;
+                FinishUpload();
+            }
         }
 
         ImageResource(const char* path)
@@ -1350,6 +1843,8 @@ namespace GFX
 
             m_deviceMemory = ktxVulkanTexture.deviceMemory;
             m_image = ktxVulkanTexture.image;
+            // Uploaded By libktx On The Graphics Queue
+            m_graphicsOwned = true;
 
             vk::ImageViewCreateInfo viewInfo;
             // Set the non-default values.
@@ -1368,10 +1863,31 @@ namespace GFX
 
         ~ImageResource()
         {
-            s_device.waitIdle();
-            s_device.destroyImageView(m_imageView);
-            s_device.freeMemory(m_deviceMemory);
-            s_device.destroyImage(m_image);
+            vk::ImageView imageView = m_imageView;
+            vk::Image image = m_image;
+            VmaAllocation allocation = m_allocation;
+            vk::DeviceMemory deviceMemory = m_deviceMemory;
+            uint32_t bindlessIndex = m_bindlessIndex;
+            DeferDeletion([imageView, image, allocation, deviceMemory, bindlessIndex]()
+            {
+                s_device.destroyImageView(imageView);
+                s_device.destroyImage(image);
+
+                if (bindlessIndex != BINDLESS_INVALID_INDEX)
+                {
+                    s_bindlessImageFreeIndices.push_back(bindlessIndex);
+                }
+
+                // KTX Textures Own Their Device Memory
+                if (allocation != nullptr)
+                {
+                    vmaFreeMemory(s_allocator, allocation);
+                }
+                else
+                {
+                    s_device.freeMemory(deviceMemory);
+                }
+            });
         }
 
         vk::ImageUsageFlags MapImageUsageForVulkan(const ImageUsage& imageUsage)
@@ -1384,6 +1900,8 @@ namespace GFX
                 return vk::ImageUsageFlagBits::eColorAttachment;
             case ImageUsage::DepthStencilAttachment:
                 return vk::ImageUsageFlagBits::eDepthStencilAttachment;
+            case ImageUsage::StorageImage:
+                return vk::ImageUsageFlagBits::eStorage | vk::ImageUsageFlagBits::eSampled;
             default:
                 assert(false);
                 return vk::ImageUsageFlagBits::eSampled;
@@ -1429,10 +1947,14 @@ namespace GFX
 
         vk::Format m_format = vk::Format::eR8G8B8A8Snorm;
 
+        VmaAllocation m_allocation = nullptr;
         vk::DeviceMemory m_deviceMemory = nullptr;
         vk::Image m_image = nullptr;
         vk::ImageView m_imageView = nullptr;
 
+        bool m_graphicsOwned = false;
+        uint32_t m_bindlessIndex = BINDLESS_INVALID_INDEX;
+
         ktxVulkanTexture ktxVulkanTexture;
         bool ktxInitialized = false;
     };
@@ -1443,50 +1965,97 @@ namespace GFX
         {
             m_layout = desc.m_layout;
             m_storageMode = desc.m_storageMode;
+            m_desc = desc;
 
             auto descriptorSetCount = desc.m_storageMode == UniformStorageMode::Dynamic ? s_swapChainImages.size() : 1;
 
-            // Create Descriptor Sets
-            vk::DescriptorSetAllocateInfo descriptorSetAllocateInfo = {};
-            descriptorSetAllocateInfo.setDescriptorPool(s_descriptorPoolDefault);
-            descriptorSetAllocateInfo.setDescriptorSetCount(descriptorSetCount);
             UniformLayoutResource* uniformLayoutResource = s_uniformLayoutHandlePool.FetchResource(desc.m_layout.id);
+            m_dynamicBindingCount = uniformLayoutResource->m_dynamicBindingCount;
+            m_descriptorCounts = uniformLayoutResource->m_descriptorCounts;
+            m_descriptorTypes = uniformLayoutResource->m_descriptorTypes;
+            m_inputAttachmentAttributes = desc.m_inputAttachmentAttributes;
+            m_sampledAttachmentAttributes = desc.m_sampledAttachmentAttributes;
+
+            // Create Descriptor Sets
+            if (desc.m_storageMode == UniformStorageMode::Transient)
+            {
+                // Transient Sets Only Live For The Frame Being Recorded
+                assert(s_frameRecording);
+                m_descriptorPool = AllocateDescriptorSets(s_transientDescriptorPools[s_currentFrame], uniformLayoutResource, descriptorSetCount, m_descriptorSets);
+            }
+            else
+            {
+                m_descriptorPool = AllocateDescriptorSets(s_persistentDescriptorPools, uniformLayoutResource, descriptorSetCount, m_descriptorSets);
+            }
 
-            std::vector<vk::DescriptorSetLayout> layouts(descriptorSetCount, uniformLayoutResource->m_descriptorSetLayout);
-            descriptorSetAllocateInfo.setPSetLayouts(layouts.data());
+            for (auto& attribute : desc.m_bufferAtrributes)
+            {
+                m_atrributes[attribute.binding] = attribute;
+            }
 
-            auto allocateDescriptorSetsResult = s_device.allocateDescriptorSets(descriptorSetAllocateInfo);
-            VK_ASSERT(allocateDescriptorSetsResult);
-            m_descriptorSets = allocateDescriptorSetsResult.value;
+            WriteDescriptorSets(desc);
+        }
 
-            for (size_t i = 0; i < descriptorSetCount; i++)
+        // Gathers The Writes Of Every Attribute In Every Set Into One updateDescriptorSets Call, No Device Wait Is Needed
+        // Since Freshly Allocated Sets Are Not Referenced By Any Command Buffer Yet
+        void WriteDescriptorSets(const UniformDescription& desc)
+        {
+            size_t setCount = m_descriptorSets.size();
+            size_t bufferCount = (desc.m_bufferAtrributes.size() + desc.m_transientBufferAttributes.size()) * setCount;
+            size_t imageCount = (desc.m_inputAttachmentAttributes.size() + desc.m_sampledAttachmentAttributes.size() + desc.m_storageImageAttributes.size() + desc.m_imageAttributes.size()) * setCount;
+
+            // Reserved Up Front, The Writes Keep Pointers Into These
+            std::vector<vk::DescriptorBufferInfo> bufferInfos;
+            bufferInfos.reserve(bufferCount);
+            std::vector<vk::DescriptorImageInfo> imageInfos;
+            imageInfos.reserve(imageCount);
+            std::vector<vk::WriteDescriptorSet> writes;
+            writes.reserve(bufferCount + imageCount);
+
+            for (size_t i = 0; i < setCount; i++)
             {
                 for (size_t j = 0; j < desc.m_bufferAtrributes.size(); j++)
                 {
-                    s_device.waitIdle();
-
                     auto attribute = desc.m_bufferAtrributes[j];
                     BufferResource* bufferResource = s_bufferHandlePool.FetchResource(attribute.buffer.id);
 
-                    if (i == 0)
-                    {
-                        m_atrributes[attribute.binding] = attribute;
-                    }
-
                     vk::DescriptorBufferInfo bufferInfo = {};
                     bufferInfo.setBuffer(bufferResource->m_buffer);
                     bufferInfo.setOffset(attribute.offset + (bufferResource->m_size * i));
                     bufferInfo.setRange(attribute.range);
+                    bufferInfos.push_back(bufferInfo);
+
+                    vk::WriteDescriptorSet writeDescriptorSet = {};
+                    writeDescriptorSet.setDescriptorCount(1);
+                    writeDescriptorSet.setPBufferInfo(&bufferInfos.back());
+                    writeDescriptorSet.setDstBinding(attribute.binding);
+                    writeDescriptorSet.setDstArrayElement(0);
+                    writeDescriptorSet.setDstSet(m_descriptorSets[i]);
+                    writeDescriptorSet.setDescriptorType(m_descriptorTypes[attribute.binding]);
+
+                    writes.push_back(writeDescriptorSet);
+                }
+
+                for (size_t j = 0; j < desc.m_transientBufferAttributes.size(); j++)
+                {
+                    auto attribute = desc.m_transientBufferAttributes[j];
+
+                    // Base Offset Zero, The Allocation Offset Is Supplied When Binding
+                    vk::DescriptorBufferInfo bufferInfo = {};
+                    bufferInfo.setBuffer(s_transientUniformBuffer);
+                    bufferInfo.setOffset(0);
+                    bufferInfo.setRange(attribute.range);
+                    bufferInfos.push_back(bufferInfo);
 
                     vk::WriteDescriptorSet writeDescriptorSet = {};
                     writeDescriptorSet.setDescriptorCount(1);
-                    writeDescriptorSet.setPBufferInfo(&bufferInfo);
+                    writeDescriptorSet.setPBufferInfo(&bufferInfos.back());
                     writeDescriptorSet.setDstBinding(attribute.binding);
                     writeDescriptorSet.setDstArrayElement(0);
                     writeDescriptorSet.setDstSet(m_descriptorSets[i]);
-                    writeDescriptorSet.setDescriptorType(vk::DescriptorType::eUniformBuffer);
+                    writeDescriptorSet.setDescriptorType(vk::DescriptorType::eUniformBufferDynamic);
 
-                    s_device.updateDescriptorSets(writeDescriptorSet, nullptr);
+                    writes.push_back(writeDescriptorSet);
                 }
 
                 for (size_t j = 0; j < desc.m_inputAttachmentAttributes.size(); j++)
@@ -1510,16 +2079,17 @@ namespace GFX
                     imageInfo.setImageLayout(vk::ImageLayout::eShaderReadOnlyOptimal);
                     // imageInfo.setSampler(samplerResource->m_sampler);
                     imageInfo.setImageView(imageView);
+                    imageInfos.push_back(imageInfo);
 
                     vk::WriteDescriptorSet writeDescriptorSet = {};
                     writeDescriptorSet.setDescriptorCount(1);
-                    writeDescriptorSet.setPImageInfo(&imageInfo);
+                    writeDescriptorSet.setPImageInfo(&imageInfos.back());
                     writeDescriptorSet.setDstBinding(attribute.binding);
                     writeDescriptorSet.setDstArrayElement(0);
                     writeDescriptorSet.setDstSet(m_descriptorSets[i]);
                     writeDescriptorSet.setDescriptorType(vk::DescriptorType::eInputAttachment);
 
-                    s_device.updateDescriptorSets(writeDescriptorSet, nullptr);
+                    writes.push_back(writeDescriptorSet);
                 }
 
                 for (size_t j = 0; j < desc.m_sampledAttachmentAttributes.size(); j++)
@@ -1555,21 +2125,42 @@ namespace GFX
                     }
                     imageInfo.setSampler(samplerResource->m_sampler);
                     imageInfo.setImageView(imageView);
+                    imageInfos.push_back(imageInfo);
 
                     vk::WriteDescriptorSet writeDescriptorSet = {};
                     writeDescriptorSet.setDescriptorCount(1);
-                    writeDescriptorSet.setPImageInfo(&imageInfo);
+                    writeDescriptorSet.setPImageInfo(&imageInfos.back());
                     writeDescriptorSet.setDstBinding(attribute.binding);
                     writeDescriptorSet.setDstArrayElement(0);
                     writeDescriptorSet.setDstSet(m_descriptorSets[i]);
                     writeDescriptorSet.setDescriptorType(vk::DescriptorType::eCombinedImageSampler);
 
-                    s_device.updateDescriptorSets(writeDescriptorSet, nullptr);
+                    writes.push_back(writeDescriptorSet);
+                }
+
+                for (size_t j = 0; j < desc.m_storageImageAttributes.size(); j++)
+                {
+                    auto attribute = desc.m_storageImageAttributes[j];
+                    ImageResource* imageResource = s_imageHandlePool.FetchResource(attribute.image.id);
+
+                    vk::DescriptorImageInfo imageInfo = {};
+                    imageInfo.setImageLayout(vk::ImageLayout::eGeneral);
+                    imageInfo.setImageView(imageResource->m_imageView);
+                    imageInfos.push_back(imageInfo);
+
+                    vk::WriteDescriptorSet writeDescriptorSet = {};
+                    writeDescriptorSet.setDescriptorCount(1);
+                    writeDescriptorSet.setPImageInfo(&imageInfos.back());
+                    writeDescriptorSet.setDstBinding(attribute.binding);
+                    writeDescriptorSet.setDstArrayElement(0);
+                    writeDescriptorSet.setDstSet(m_descriptorSets[i]);
+                    writeDescriptorSet.setDescriptorType(vk::DescriptorType::eStorageImage);
+
+                    writes.push_back(writeDescriptorSet);
                 }
 
                 for (size_t j = 0; j < desc.m_imageAttributes.size(); j++)
                 {
-                    s_device.waitIdle();
                     auto attribute = desc.m_imageAttributes[j];
                     ImageResource* imageResource = s_imageHandlePool.FetchResource(attribute.image.id);
                     SamplerResource* samplerResource = s_samplerHandlePool.FetchResource(attribute.sampler.id);
@@ -1578,24 +2169,107 @@ namespace GFX
                     imageInfo.setImageLayout(vk::ImageLayout::eShaderReadOnlyOptimal);
                     imageInfo.setSampler(samplerResource->m_sampler);
                     imageInfo.setImageView(imageResource->m_imageView);
+                    imageInfos.push_back(imageInfo);
 
                     vk::WriteDescriptorSet writeDescriptorSet = {};
                     writeDescriptorSet.setDescriptorCount(1);
-                    writeDescriptorSet.setPImageInfo(&imageInfo);
+                    writeDescriptorSet.setPImageInfo(&imageInfos.back());
                     writeDescriptorSet.setDstBinding(attribute.binding);
                     writeDescriptorSet.setDstArrayElement(0);
                     writeDescriptorSet.setDstSet(m_descriptorSets[i]);
                     writeDescriptorSet.setDescriptorType(vk::DescriptorType::eCombinedImageSampler);
 
-                    s_device.updateDescriptorSets(writeDescriptorSet, nullptr);
+                    writes.push_back(writeDescriptorSet);
+                }
+            }
+
+            if (!writes.empty())
+            {
+                s_device.updateDescriptorSets(writes, nullptr);
+            }
+        }
+
+        // Called Once The Handle Is Known, Lets Each Referenced Render Pass Refresh This Uniform On Resize
+        void RegisterAttachmentDependencies()
+        {
+            for (auto& attribute : m_inputAttachmentAttributes)
+            {
+                m_attachmentRenderPasses.push_back(attribute.renderPass.id);
+            }
+
+            for (auto& attribute : m_sampledAttachmentAttributes)
+            {
+                m_attachmentRenderPasses.push_back(attribute.renderPass.id);
+            }
+
+            std::sort(m_attachmentRenderPasses.begin(), m_attachmentRenderPasses.end());
+            m_attachmentRenderPasses.erase(std::unique(m_attachmentRenderPasses.begin(), m_attachmentRenderPasses.end()), m_attachmentRenderPasses.end());
+
+            for (auto renderPassHandle : m_attachmentRenderPasses)
+            {
+                s_renderPassHandlePool.FetchResource(renderPassHandle)->m_dependentUniforms.push_back(handle);
+            }
+        }
+
+        void UnregisterAttachmentDependencies()
+        {
+            for (auto renderPassHandle : m_attachmentRenderPasses)
+            {
+                // The Render Pass May Already Be Destroyed
+                if (!s_renderPassHandlePool.IsValid(renderPassHandle))
+                {
+                    continue;
                 }
+
+                auto& dependents = s_renderPassHandlePool.FetchResource(renderPassHandle)->m_dependentUniforms;
+                dependents.erase(std::remove(dependents.begin(), dependents.end(), handle), dependents.end());
+            }
+            m_attachmentRenderPasses.clear();
+        }
+
+        // Frames In Flight May Still Read The Current Sets, So They Are Retired With Those Frames And Fresh Sets
+        // Are Written From The Stored Description, Picking Up The Recreated Attachments Of The Render Pass
+        void RefreshAttachmentDescriptors(uint32_t renderPassHandle)
+        {
+            // Transient Sets Die With Their Frame, Resizing Happens Outside Frames
+            if (m_storageMode == UniformStorageMode::Transient)
+            {
+                return;
             }
+
+            ReleaseDescriptorSetsDeferred();
+
+            UniformLayoutResource* uniformLayoutResource = s_uniformLayoutHandlePool.FetchResource(m_layout.id);
+            uint32_t descriptorSetCount = m_descriptorSets.size();
+            m_descriptorSets.clear();
+            m_descriptorPool = AllocateDescriptorSets(s_persistentDescriptorPools, uniformLayoutResource, descriptorSetCount, m_descriptorSets);
+
+            WriteDescriptorSets(m_desc);
+        }
+
+        void ReleaseDescriptorSetsDeferred()
+        {
+            std::vector<vk::DescriptorSet> descriptorSets = m_descriptorSets;
+            vk::DescriptorPool descriptorPool = m_descriptorPool;
+            std::map<vk::DescriptorType, uint32_t> descriptorCounts = m_descriptorCounts;
+            DeferDeletion([descriptorSets, descriptorPool, descriptorCounts]()
+            {
+                s_device.freeDescriptorSets(descriptorPool, descriptorSets.size(), descriptorSets.data());
+                ReleaseDescriptorSets(s_persistentDescriptorPools, descriptorCounts, descriptorSets.size());
+            });
         }
 
         ~UniformResource()
         {
-            s_device.waitIdle();
-            s_device.freeDescriptorSets(s_descriptorPoolDefault, m_descriptorSets.size(), m_descriptorSets.data());
+            UnregisterAttachmentDependencies();
+
+            // Transient Sets Go Back When Their Frame's Pools Are Reset
+            if (m_storageMode == UniformStorageMode::Transient)
+            {
+                return;
+            }
+
+            ReleaseDescriptorSetsDeferred();
         }
 
         uint32_t handle = 0;
@@ -1603,10 +2277,85 @@ namespace GFX
         UniformLayout m_layout;
         UniformStorageMode m_storageMode;
         std::map<uint32_t, UniformBufferAtrribute> m_atrributes;
+        uint32_t m_dynamicBindingCount = 0;
+        std::map<vk::DescriptorType, uint32_t> m_descriptorCounts;
+        std::map<uint32_t, vk::DescriptorType> m_descriptorTypes;
+
+        // Kept To Rewrite Attachment Descriptors When The Render Pass Is Resized
+        std::vector<UniformInputAttachmentAttribute> m_inputAttachmentAttributes;
+        std::vector<UniformSampledAttachmentAttribute> m_sampledAttachmentAttributes;
+        std::vector<uint32_t> m_attachmentRenderPasses;
 
+        // Everything The Sets Were Written From, Replayed Into New Sets On Resize
+        UniformDescription m_desc;
+
+        vk::DescriptorPool m_descriptorPool = nullptr;
         std::vector<vk::DescriptorSet> m_descriptorSets;
     };
 
+    struct RenderBundleResource
+    {
+        RenderBundleResource(RenderPass renderPass, uint32_t subpass)
+        {
+            m_renderPass = renderPass;
+            m_subpass = subpass;
+        }
+
+        ~RenderBundleResource()
+        {
+            ReleaseCommandBuffers();
+        }
+
+        // Drops The Recorded Buffers, The Captured Commands Are Replayed Into New Ones On The Next Execute
+        void ReleaseCommandBuffers()
+        {
+            std::vector<vk::CommandBuffer> commandBuffers;
+            for (auto commandBuffer : m_commandBuffers)
+            {
+                if (commandBuffer)
+                {
+                    commandBuffers.push_back(commandBuffer);
+                }
+            }
+            m_commandBuffers.clear();
+
+            if (commandBuffers.empty())
+            {
+                return;
+            }
+
+            DeferDeletion([commandBuffers]()
+            {
+                s_device.freeCommandBuffers(s_renderBundleCommandPool, commandBuffers);
+            });
+        }
+
+        void Invalidate()
+        {
+            m_valid = false;
+            m_commands.clear();
+            ReleaseCommandBuffers();
+        }
+
+        uint32_t handle = 0;
+
+        RenderPass m_renderPass;
+        uint32_t m_subpass = 0;
+        bool m_valid = true;
+
+        // Recording Calls Captured Between BeginRenderBundle And EndRenderBundle
+        std::vector<std::function<void()>> m_commands;
+
+        // Resources The Captured Commands Use, Destroying One Invalidates The Bundle
+        std::vector<uint32_t> m_pipelines;
+        std::vector<uint32_t> m_buffers;
+        std::vector<uint32_t> m_uniforms;
+
+        // One Secondary Buffer Per Swap Chain Image, Recorded When That Image First Executes The Bundle
+        std::vector<vk::CommandBuffer> m_commandBuffers;
+        RenderStatistics m_statistics;
+    };
+
     /*
     =================================================Implementation===========================================================
     */
@@ -1619,20 +2368,38 @@ namespace GFX
     {
         Pipeline result = Pipeline();
         
-        PipelineResource* pipelineResource = new PipelineResource(desc);
-        result.id = s_pipelineHandlePool.AllocateHandle(pipelineResource);
+        result.id = s_pipelineHandlePool.Allocate(desc);
+        PipelineResource* pipelineResource = s_pipelineHandlePool.FetchResource(result.id);
         
         pipelineResource->handle = result.id;
 
         return result;
     }
 
+    Pipeline CreateComputePipeline(const ComputePipelineDescription& desc)
+    {
+        Pipeline result = Pipeline();
+
+        result.id = s_pipelineHandlePool.Allocate(desc);
+        PipelineResource* pipelineResource = s_pipelineHandlePool.FetchResource(result.id);
+
+        pipelineResource->handle = result.id;
+
+        return result;
+    }
+
+    bool IsVertexFormatSupported(ValueType valueType)
+    {
+        vk::FormatProperties props = s_physicalDevice.getFormatProperties(MapTypeFormatForVulkan(valueType));
+        return static_cast<bool>(props.bufferFeatures & vk::FormatFeatureFlagBits::eVertexBuffer);
+    }
+
     Shader CreateShader(const ShaderDescription& desc)
     {
         Shader result = Shader();
 
-        ShaderResource* shaderResource = new ShaderResource(desc);
-        result.id = s_shaderHandlePool.AllocateHandle(shaderResource);
+        result.id = s_shaderHandlePool.Allocate(desc);
+        ShaderResource* shaderResource = s_shaderHandlePool.FetchResource(result.id);
 
         shaderResource->handle = result.id;
 
@@ -1643,8 +2410,8 @@ namespace GFX
     {
         RenderPass result = RenderPass();
 
-        RenderPassResource* renderPassResource = new RenderPassResource(desc);
-        result.id = s_renderPassHandlePool.AllocateHandle(renderPassResource);
+        result.id = s_renderPassHandlePool.Allocate(desc);
+        RenderPassResource* renderPassResource = s_renderPassHandlePool.FetchResource(result.id);
 
         renderPassResource->handle = result.id;
 
@@ -1655,8 +2422,8 @@ namespace GFX
     {
         Buffer result = Buffer();
 
-        BufferResource* bufferResource = new BufferResource(desc);
-        result.id = s_bufferHandlePool.AllocateHandle(bufferResource);
+        result.id = s_bufferHandlePool.Allocate(desc);
+        BufferResource* bufferResource = s_bufferHandlePool.FetchResource(result.id);
 
         bufferResource->handle = result.id;
 
@@ -1667,11 +2434,18 @@ namespace GFX
     {
         Image result = Image();
 
-        ImageResource* imageResource = new ImageResource(desc);
-        result.id = s_imageHandlePool.AllocateHandle(imageResource);
+        result.id = s_imageHandlePool.Allocate(desc);
+        ImageResource* imageResource = s_imageHandlePool.FetchResource(result.id);
 
         imageResource->handle = result.id;
 
+        if (s_bindlessEnabled && (desc.usage == ImageUsage::SampledImage || desc.usage == ImageUsage::StorageImage))
+        {
+            imageResource->m_bindlessIndex = AllocateBindlessIndex(s_bindlessImageCount, s_bindlessImageFreeIndices, BINDLESS_IMAGE_CAPACITY);
+            vk::ImageLayout layout = desc.usage == ImageUsage::StorageImage ? vk::ImageLayout::eGeneral : vk::ImageLayout::eShaderReadOnlyOptimal;
+            WriteBindlessImage(imageResource->m_bindlessIndex, imageResource->m_imageView, layout);
+        }
+
         return result;
     }
 
@@ -1679,11 +2453,17 @@ namespace GFX
     {
         Image result = Image();
         
-        ImageResource* imageResource = new ImageResource(path);
-        result.id = s_imageHandlePool.AllocateHandle(imageResource);
+        result.id = s_imageHandlePool.Allocate(path);
+        ImageResource* imageResource = s_imageHandlePool.FetchResource(result.id);
 
         imageResource->handle = result.id;
 
+        if (s_bindlessEnabled)
+        {
+            imageResource->m_bindlessIndex = AllocateBindlessIndex(s_bindlessImageCount, s_bindlessImageFreeIndices, BINDLESS_IMAGE_CAPACITY);
+            WriteBindlessImage(imageResource->m_bindlessIndex, imageResource->m_imageView, vk::ImageLayout::eShaderReadOnlyOptimal);
+        }
+
         return result;
     }
 
@@ -1691,11 +2471,17 @@ namespace GFX
     {
         Sampler result = Sampler();
 
-        SamplerResource* samplerResource = new SamplerResource(desc);
-        result.id = s_samplerHandlePool.AllocateHandle(samplerResource);
+        result.id = s_samplerHandlePool.Allocate(desc);
+        SamplerResource* samplerResource = s_samplerHandlePool.FetchResource(result.id);
 
         samplerResource->handle = result.id;
 
+        if (s_bindlessEnabled)
+        {
+            samplerResource->m_bindlessIndex = AllocateBindlessIndex(s_bindlessSamplerCount, s_bindlessSamplerFreeIndices, BINDLESS_SAMPLER_CAPACITY);
+            WriteBindlessSampler(samplerResource->m_bindlessIndex, samplerResource->m_sampler);
+        }
+
         return result;
     }
 
@@ -1703,8 +2489,8 @@ namespace GFX
     {
         UniformLayout result = UniformLayout();
 
-        UniformLayoutResource* uniformLayoutResource = new UniformLayoutResource(desc);
-        result.id = s_uniformLayoutHandlePool.AllocateHandle(uniformLayoutResource);
+        result.id = s_uniformLayoutHandlePool.Allocate(desc);
+        UniformLayoutResource* uniformLayoutResource = s_uniformLayoutHandlePool.FetchResource(result.id);
 
         uniformLayoutResource->handle = result.id;
 
@@ -1715,10 +2501,16 @@ namespace GFX
     {
         Uniform result = Uniform();
 
-        UniformResource* uniformResource = new UniformResource(desc);
-        result.id = s_uniformHandlePool.AllocateHandle(uniformResource);
+        result.id = s_uniformHandlePool.Allocate(desc);
+        UniformResource* uniformResource = s_uniformHandlePool.FetchResource(result.id);
 
         uniformResource->handle = result.id;
+        uniformResource->RegisterAttachmentDependencies();
+
+        if (desc.m_storageMode == UniformStorageMode::Transient)
+        {
+            s_transientUniforms[s_currentFrame].push_back(result.id);
+        }
 
         return result;
     }
@@ -1730,16 +2522,27 @@ namespace GFX
 
     void DestroyPipeline(const Pipeline& pipeline)
     {
+        InvalidateRenderBundles(pipeline.id, &RenderBundleResource::m_pipelines);
         s_pipelineHandlePool.FreeHandle(pipeline.id);
     }
 
     void DestroyRenderPass(const RenderPass& renderPass)
     {
+        for (auto bundleHandle : s_renderBundles)
+        {
+            RenderBundleResource* bundle = s_renderBundleHandlePool.FetchResource(bundleHandle);
+            if (bundle->m_renderPass.id == renderPass.id)
+            {
+                bundle->Invalidate();
+            }
+        }
+
         s_renderPassHandlePool.FreeHandle(renderPass.id);
     }
 
     void DestroyBuffer(const Buffer& buffer)
     {
+        InvalidateRenderBundles(buffer.id, &RenderBundleResource::m_buffers);
         s_bufferHandlePool.FreeHandle(buffer.id);
     }
 
@@ -1760,9 +2563,19 @@ namespace GFX
 
     void DestroyUniform(const Uniform& uniform)
     {
+        // Transient Uniforms Are Released By The Frame That Created Them
+        assert(s_uniformHandlePool.FetchResource(uniform.id)->m_storageMode != UniformStorageMode::Transient);
+
+        InvalidateRenderBundles(uniform.id, &RenderBundleResource::m_uniforms);
         s_uniformHandlePool.FreeHandle(uniform.id);
     }
 
+    void DestroyRenderBundle(const RenderBundle& renderBundle)
+    {
+        s_renderBundles.erase(std::remove(s_renderBundles.begin(), s_renderBundles.end(), renderBundle.id), s_renderBundles.end());
+        s_renderBundleHandlePool.FreeHandle(renderBundle.id);
+    }
+
     /*
     Buffer Operation
     */
@@ -1786,12 +2599,15 @@ namespace GFX
 
     size_t AlignmentSize(size_t size, size_t alignment)
     {
+        // Vulkan Alignment Limits Are Powers Of Two
+        assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
         if (size <= alignment)
         {
             return alignment;
         }
 
-        return size + (size % alignment);
+        return (size + alignment - 1) & ~(alignment - 1);
     }
 
     size_t UniformAlign(size_t size)
@@ -1805,27 +2621,62 @@ namespace GFX
         bufferResource->Update(offset, size, data);
     }
 
+    void* MapBuffer(Buffer buffer, size_t offset, size_t size)
+    {
+        BufferResource* bufferResource = s_bufferHandlePool.FetchResource(buffer.id);
+        return bufferResource->Map(offset, size);
+    }
+
+    void UnmapBuffer(Buffer buffer)
+    {
+        BufferResource* bufferResource = s_bufferHandlePool.FetchResource(buffer.id);
+        bufferResource->Unmap();
+    }
+
+    uint64_t GetBufferDeviceAddress(Buffer buffer)
+    {
+        BufferResource* bufferResource = s_bufferHandlePool.FetchResource(buffer.id);
+        assert(bufferResource->m_deviceMemory);
+
+        vk::BufferDeviceAddressInfo addressInfo = {};
+        addressInfo.setBuffer(bufferResource->m_buffer);
+        return s_device.getBufferAddress(addressInfo);
+    }
+
+    void* GetMappedPointer(Buffer buffer)
+    {
+        BufferResource* bufferResource = s_bufferHandlePool.FetchResource(buffer.id);
+        assert(bufferResource->m_storageMode == BufferStorageMode::Dynamic);
+        return bufferResource->GetCurrentSlotPointer();
+    }
+
     void UpdateImageMemory(Image image, void* data, size_t size)
     {
         ImageResource* imageResource = s_imageHandlePool.FetchResource(image.id);
 
 
-        vk::Buffer stagingBuffer;
-        vk::DeviceMemory stagingBufferDeviceMemory;
+        UploadQueue uploadQueue = ChooseUploadQueue(imageResource->m_graphicsOwned);
 
-        CreateVulkanBuffer(imageResource->m_memSize, vk::BufferUsageFlagBits::eTransferSrc, vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent, stagingBuffer, stagingBufferDeviceMemory);
+        // Allocate Before Fetching The Command Buffer, A Full Ring Submits The Recorded Uploads
+        StagingRegion staging = AllocateStaging(size, STAGING_IMAGE_ALIGNMENT, uploadQueue);
+        memcpy(staging.mappedPtr, data, size);
 
-        auto mapMemoryResult = s_device.mapMemory(stagingBufferDeviceMemory, 0, imageResource->m_memSize);
-        VK_ASSERT(mapMemoryResult);
-        memcpy(mapMemoryResult.value, data, size);
-        s_device.unmapMemory(stagingBufferDeviceMemory);
+        auto cb = GetUploadCommandBuffer(uploadQueue);
+        RecordImageLayoutTransition(cb, imageResource->m_image, imageResource->m_format, vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferDstOptimal, imageResource->m_layerCount);
+        RecordCopyBufferToImage(cb, staging.buffer, staging.offset, imageResource->m_image, imageResource->m_width, imageResource->m_height, imageResource->m_layerCount);
 
-        TransitionImageLayout(imageResource->m_image, imageResource->m_format, vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferDstOptimal, imageResource->m_layerCount);
-        CopyBufferToImage(stagingBuffer, imageResource->m_image, imageResource->m_width, imageResource->m_height, imageResource->m_layerCount);
-        TransitionImageLayout(imageResource->m_image, imageResource->m_format, vk::ImageLayout::eTransferDstOptimal, vk::ImageLayout::eShaderReadOnlyOptimal, imageResource->m_layerCount);
+        if (uploadQueue == UploadQueue::Transfer)
+        {
+            // Release Also Performs The Transition To Shader Read
+            RecordImageOwnershipRelease(cb, imageResource->m_image, imageResource->m_layerCount);
+        }
+        else
+        {
+            RecordImageLayoutTransition(cb, imageResource->m_image, imageResource->m_format, vk::ImageLayout::eTransferDstOptimal, vk::ImageLayout::eShaderReadOnlyOptimal, imageResource->m_layerCount);
+        }
+        imageResource->m_graphicsOwned = true;
 
-        s_device.freeMemory(stagingBufferDeviceMemory);
-        s_device.destroyBuffer(stagingBuffer);
+        FinishUpload();
     }
 
     void CopyBufferToImage(Image image, Buffer buffer)
@@ -1833,9 +2684,48 @@ namespace GFX
         ImageResource* imageResource = s_imageHandlePool.FetchResource(image.id);
         BufferResource* bufferResource = s_bufferHandlePool.FetchResource(buffer.id);
 
-        TransitionImageLayout(imageResource->m_image, imageResource->m_format, vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferDstOptimal, imageResource->m_layerCount);
-        CopyBufferToImage(bufferResource->m_buffer, imageResource->m_image, imageResource->m_width, imageResource->m_height, imageResource->m_layerCount);
-        TransitionImageLayout(imageResource->m_image, imageResource->m_format, vk::ImageLayout::eTransferDstOptimal, vk::ImageLayout::eShaderReadOnlyOptimal, imageResource->m_layerCount);
+        // Source Buffer Ownership Is Not Tracked, Stay On The Graphics Queue
+        auto cb = GetUploadCommandBuffer(UploadQueue::Graphics);
+        RecordImageLayoutTransition(cb, imageResource->m_image, imageResource->m_format, vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferDstOptimal, imageResource->m_layerCount);
+        RecordCopyBufferToImage(cb, bufferResource->m_buffer, 0, imageResource->m_image, imageResource->m_width, imageResource->m_height, imageResource->m_layerCount);
+        RecordImageLayoutTransition(cb, imageResource->m_image, imageResource->m_format, vk::ImageLayout::eTransferDstOptimal, vk::ImageLayout::eShaderReadOnlyOptimal, imageResource->m_layerCount);
+        imageResource->m_graphicsOwned = true;
+
+        FinishUpload();
+    }
+
+    void BeginUploadBatch()
+    {
+        s_uploadBatchDepth++;
+    }
+
+    UploadTicket EndUploadBatch()
+    {
+        assert(s_uploadBatchDepth > 0);
+        s_uploadBatchDepth--;
+
+        if (s_uploadBatchDepth == 0)
+        {
+            SubmitUploads();
+        }
+
+        UploadTicket ticket = {};
+        ticket.id = s_uploadSubmittedSerial;
+        return ticket;
+    }
+
+    bool IsUploadComplete(UploadTicket ticket)
+    {
+        RetireUploads();
+        return ticket.id <= s_uploadCompletedSerial;
+    }
+
+    void WaitUpload(UploadTicket ticket)
+    {
+        while (ticket.id > s_uploadCompletedSerial && !s_pendingUploads.empty())
+        {
+            WaitOldestUpload();
+        }
     }
 
     void AttachmentLayoutTransition(RenderPass renderPass, uint32_t attachmentIndex, ImageLayout oldLayout, ImageLayout newLayout)
@@ -1847,666 +2737,2573 @@ namespace GFX
 
     void BindUniform(Uniform uniform, uint32_t set)
     {
-        UniformResource* uniformResource = s_uniformHandlePool.FetchResource(uniform.id);
-        if (uniformResource->m_storageMode == UniformStorageMode::Dynamic)
+        if (s_recordingBundle)
         {
-            s_currentDescriptors[set] = uniformResource->m_descriptorSets[s_currentImageIndex];
+            s_recordingBundle->m_uniforms.push_back(uniform.id);
+            s_recordingBundle->m_commands.push_back([=]() { BindUniform(uniform, set); });
+            return;
         }
-        else
+
+        UniformResource* uniformResource = s_uniformHandlePool.FetchResource(uniform.id);
+
+        vk::DescriptorSet descriptorSet = uniformResource->m_descriptorSets[0];
+        if (uniformResource->m_storageMode == UniformStorageMode::Dynamic)
         {
-            s_currentDescriptors[set] = uniformResource->m_descriptorSets[0];
+            descriptorSet = uniformResource->m_descriptorSets[s_currentImageIndex];
         }
+
+        // Dynamic Bindings Bound Without An Offset Read From The Start Of Their Range
+        uint32_t dynamicOffsets[MAX_DYNAMIC_OFFSETS_PER_SET] = {};
+        SetDescriptorSet(GetCommandContext(), set, descriptorSet, dynamicOffsets, uniformResource->m_dynamicBindingCount);
     }
 
-    void UpdateUniformBuffer(Uniform uniform, uint32_t binding, void* data)
+    void BindUniform(Uniform uniform, uint32_t set, uint32_t dynamicOffset)
     {
+        if (s_recordingBundle)
+        {
+            s_recordingBundle->m_uniforms.push_back(uniform.id);
+            s_recordingBundle->m_commands.push_back([=]() { BindUniform(uniform, set, dynamicOffset); });
+            return;
+        }
+
         UniformResource* uniformResource = s_uniformHandlePool.FetchResource(uniform.id);
-        auto attribute = uniformResource->m_atrributes[binding];
-        GFX::UpdateBuffer(attribute.buffer, attribute.offset, attribute.range, data);
+        assert(uniformResource->m_dynamicBindingCount == 1);
+
+        vk::DescriptorSet descriptorSet = uniformResource->m_descriptorSets[0];
+        if (uniformResource->m_storageMode == UniformStorageMode::Dynamic)
+        {
+            descriptorSet = uniformResource->m_descriptorSets[s_currentImageIndex];
+        }
+
+        SetDescriptorSet(GetCommandContext(), set, descriptorSet, &dynamicOffset, 1);
     }
 
-    /*
-    Operations
-    */
-    void ApplyPipeline(Pipeline pipeline)
+    TransientUniformAllocation AllocateTransientUniform(size_t size)
     {
-        s_currentDescriptors.clear();
+        TransientUniformAllocation result = {};
 
-        PipelineResource* pipelineResource = s_pipelineHandlePool.FetchResource(pipeline.id);
-        s_currentPipleline = pipelineResource;
+        vk::DeviceSize alignedSize = UniformAlign(size);
+        vk::DeviceSize regionEnd = (s_currentFrame + 1) * TRANSIENT_UNIFORM_REGION_SIZE;
+
+        // Spilling Into The Next Region Would Overwrite Data The GPU May Still Read, Fail In Release Builds Too
+        if (s_transientUniformHead + alignedSize > regionEnd)
+        {
+            printf("GFX: Transient uniform region exhausted, %zu bytes requested, %llu of %llu bytes used this frame \n",
+                size,
+                static_cast<unsigned long long>(s_transientUniformHead - s_currentFrame * TRANSIENT_UNIFORM_REGION_SIZE),
+                static_cast<unsigned long long>(TRANSIENT_UNIFORM_REGION_SIZE));
+            abort();
+        }
+
+        assert(s_transientUniformHead % s_physicalDeviceProperties.limits.minUniformBufferOffsetAlignment == 0);
+
+        result.data = s_transientUniformMappedPtr + s_transientUniformHead;
+        result.offset = static_cast<uint32_t>(s_transientUniformHead);
+
+        s_transientUniformHead += alignedSize;
 
-        s_commandBuffersDefault[s_currentImageIndex].bindPipeline(vk::PipelineBindPoint::eGraphics, pipelineResource->m_pipeline);
+        return result;
     }
 
-    void BindIndexBuffer(Buffer buffer, size_t offset, IndexType indexType)
+    bool IsBindlessSupported()
     {
-        BufferResource* bufferResource = s_bufferHandlePool.FetchResource(buffer.id);
-        s_commandBuffersDefault[s_currentImageIndex].bindIndexBuffer(bufferResource->m_buffer, offset, MapIndexTypeFormatForVulkan(indexType));
+        return s_bindlessEnabled;
     }
 
-    void BindVertexBuffer(Buffer buffer, size_t offset, uint32_t binding)
+    UniformLayout GetBindlessUniformLayout()
     {
-        BufferResource* bufferResource = s_bufferHandlePool.FetchResource(buffer.id);
-        vk::DeviceSize vkOffset = {offset};
-        s_commandBuffersDefault[s_currentImageIndex].bindVertexBuffers(binding, 1, &bufferResource->m_buffer, &vkOffset);
+        assert(s_bindlessEnabled);
+        return s_bindlessUniformLayout;
     }
 
-    void Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
+    uint32_t GetBindlessIndex(Image image)
     {
-        std::vector<vk::DescriptorSet> descriptorSets;
-        for (int i = 0; i < s_currentDescriptors.size(); i++)
-        {
-            descriptorSets.push_back(s_currentDescriptors[i]);
-        }
-
-        if (descriptorSets.size() > 0)
-        {
-            s_commandBuffersDefault[s_currentImageIndex].bindDescriptorSets(vk::PipelineBindPoint::eGraphics, s_currentPipleline->m_pipelineLayout, 0, descriptorSets, nullptr);
-        }
+        ImageResource* imageResource = s_imageHandlePool.FetchResource(image.id);
+        assert(imageResource->m_bindlessIndex != BINDLESS_INVALID_INDEX);
+        return imageResource->m_bindlessIndex;
+    }
 
-        s_commandBuffersDefault[s_currentImageIndex].draw(vertexCount, instanceCount, firstVertex, firstInstance);
+    uint32_t GetBindlessIndex(Sampler sampler)
+    {
+        SamplerResource* samplerResource = s_samplerHandlePool.FetchResource(sampler.id);
+        assert(samplerResource->m_bindlessIndex != BINDLESS_INVALID_INDEX);
+        return samplerResource->m_bindlessIndex;
     }
 
-    void DrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, uint32_t vertexOffset, uint32_t firstInstance)
+    void BindBindlessUniform(uint32_t set)
     {
-        std::vector<vk::DescriptorSet> descriptorSets;
-        for (int i = 0; i < s_currentDescriptors.size(); i++)
-        {
-            descriptorSets.push_back(s_currentDescriptors[i]);
-        }
+        assert(s_bindlessEnabled);
 
-        if (descriptorSets.size() > 0)
+        if (s_recordingBundle)
         {
-            s_commandBuffersDefault[s_currentImageIndex].bindDescriptorSets(vk::PipelineBindPoint::eGraphics, s_currentPipleline->m_pipelineLayout, 0, descriptorSets, nullptr);
+            s_recordingBundle->m_commands.push_back([=]() { BindBindlessUniform(set); });
+            return;
         }
 
-        s_commandBuffersDefault[s_currentImageIndex].drawIndexed(indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+        CommandContext& context = GetCommandContext();
+        context.bindlessSetIndex = static_cast<int32_t>(set);
+        SetDescriptorSet(context, set, s_bindlessDescriptorSet, nullptr, 0);
     }
 
-    void SetViewport(float x, float y, float w, float h)
+    void UpdateUniformBuffer(Uniform uniform, uint32_t binding, void* data)
     {
-        vk::Viewport newViewport = {};
-        newViewport.setX(x);
-        newViewport.setY(y);
-        newViewport.setWidth(w);
-        newViewport.setHeight(h);
-        newViewport.setMinDepth(0.0f);
-        newViewport.setMaxDepth(1.0f);
-
-        s_commandBuffersDefault[s_currentImageIndex].setViewport(0, 1, &newViewport);
-        
+        UniformResource* uniformResource = s_uniformHandlePool.FetchResource(uniform.id);
+        auto attribute = uniformResource->m_atrributes[binding];
+        GFX::UpdateBuffer(attribute.buffer, attribute.offset, attribute.range, data);
     }
 
-    void SetScissor(float x, float y, float w, float h)
+    /*
+    Statistics
+    */
+    RenderStatistics GetRenderStatistics()
     {
-        vk::Rect2D scissor = {};
-        scissor.setOffset({ static_cast<int32_t>(x), static_cast<int32_t>(y) });
-        scissor.setExtent({ static_cast<uint32_t>(w), static_cast<uint32_t>(h) });
-        
-        s_commandBuffersDefault[s_currentImageIndex].setScissor(0, scissor);
+        return s_lastFrameRenderStatistics;
     }
 
-    /*
-    Life Cycle
-    */
+    DescriptorStatistics GetDescriptorStatistics()
+    {
+        DescriptorStatistics result = {};
+        result.persistentPoolCount = s_persistentDescriptorPools.pools.size();
+        result.persistentSetCount = s_persistentDescriptorPools.setCount;
 
-    void Init(const InitialDescription& desc)
+        const DescriptorPoolChain& transientPools = s_transientDescriptorPools[s_currentFrame];
+        result.transientPoolCount = transientPools.pools.size();
+        result.transientSetCount = transientPools.setCount;
+
+        return result;
+    }
+
+    MemoryStatistics GetMemoryStatistics()
     {
-        std::map<const char*, const char*> instanceExtensions;
-        std::map<const char*, const char*> deviceExtensions;
+        MemoryStatistics result = {};
 
-        for (auto extensionName : s_expectedExtensions)
+        MemoryPoolStatistics* poolStatistics[MEMORY_POOL_COUNT] = 
         {
-            deviceExtensions[extensionName] = extensionName;
-        }
+            &result.staticGeometry,
+            &result.dynamicUniform,
+            &result.staging,
+            &result.renderTarget
+        };
 
-        for (auto extension : desc.extensions)
+        for (uint32_t i = 0; i < MEMORY_POOL_COUNT; i++)
         {
-            if (extension == GFX::Extension::Raytracing)
-            {
-                instanceExtensions[VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME] = VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME;
-                deviceExtensions[VK_KHR_RAY_TRACING_EXTENSION_NAME] = VK_KHR_RAY_TRACING_EXTENSION_NAME;
-                deviceExtensions[VK_KHR_MAINTENANCE3_EXTENSION_NAME] = VK_KHR_MAINTENANCE3_EXTENSION_NAME;
-                deviceExtensions[VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME] = VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME;
-                deviceExtensions[VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME] = VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME;
-                deviceExtensions[VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME] = VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME;
-            }
-        }
+            VmaPoolStats poolStats = {};
+            vmaGetPoolStats(s_allocator, s_memoryPools[i], &poolStats);
 
-        auto enumerateInstanceExtensionPropsResult = vk::enumerateInstanceExtensionProperties();
-        VK_ASSERT(enumerateInstanceExtensionPropsResult);
-        s_extensions = enumerateInstanceExtensionPropsResult.value;
+            poolStatistics[i]->blockCount = poolStats.blockCount;
+            poolStatistics[i]->allocationCount = poolStats.allocationCount;
+            poolStatistics[i]->reservedBytes = poolStats.size;
+            poolStatistics[i]->usedBytes = poolStats.size - poolStats.unusedSize;
+        }
 
-        auto enumerateInstanceLayerPropsResult = vk::enumerateInstanceLayerProperties();
-        VK_ASSERT(enumerateInstanceLayerPropsResult);
-        s_layers = enumerateInstanceLayerPropsResult.value;
+        VmaStats stats = {};
+        vmaCalculateStats(s_allocator, &stats);
 
-        vk::ApplicationInfo appInfo = vk::ApplicationInfo();
-        appInfo.setPApplicationName("Mo Renderer");
-        appInfo.setApplicationVersion(VK_MAKE_VERSION(0, 0, 1));
-        appInfo.setPEngineName("MO");
-        appInfo.setEngineVersion(VK_MAKE_VERSION(0, 0, 1));
-        appInfo.setApiVersion(VK_API_VERSION_1_2);
+        result.total.blockCount = stats.total.blockCount;
+        result.total.allocationCount = stats.total.allocationCount;
+        result.total.reservedBytes = stats.total.usedBytes + stats.total.unusedBytes;
+        result.total.usedBytes = stats.total.usedBytes;
 
-        vk::InstanceCreateInfo createInfo = vk::InstanceCreateInfo();
-        createInfo.setPApplicationInfo(&appInfo);
+        return result;
+    }
 
-        uint32_t glfwExtensionCount = 0;
-        const char** glfwExtensions;
-        glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
-        for (int i = 0; i < glfwExtensionCount; i++)
-        {
-            instanceExtensions[glfwExtensions[i]] = glfwExtensions[i];
-        }
-        
-        std::vector<const char*> finalInstanceExtensions;
-        for (auto& pair : instanceExtensions)
+    /*
+    Operations
+    */
+    void ApplyPipeline(Pipeline pipeline)
+    {
+        if (s_recordingBundle)
         {
-            finalInstanceExtensions.push_back(pair.second);
+            s_recordingBundle->m_pipelines.push_back(pipeline.id);
+            s_recordingBundle->m_commands.push_back([=]() { ApplyPipeline(pipeline); });
+            return;
         }
 
-        createInfo.setEnabledExtensionCount(finalInstanceExtensions.size());
-        createInfo.setPpEnabledExtensionNames(finalInstanceExtensions.data());
+        CommandContext& context = GetCommandContext();
+        PipelineResource* pipelineResource = s_pipelineHandlePool.FetchResource(pipeline.id);
 
-        if (desc.debugMode)
+        if (context.boundPipeline == pipelineResource->m_pipeline)
         {
-            s_expectedLayers.push_back("VK_LAYER_KHRONOS_validation");   
+            context.statistics.redundantPipelineBinds++;
+            return;
         }
 
-        if (CheckLayerSupport(s_expectedLayers))
+        // Sets Below The First Incompatible Set Layout Stay Bound Across The Pipeline Change
+        uint32_t compatibleSetCount = GetCompatibleSetCount(context.pipeline, pipelineResource);
+        for (uint32_t i = compatibleSetCount; i < MAX_DESCRIPTOR_SETS; i++)
         {
-            createInfo.setEnabledLayerCount(s_expectedLayers.size());
-            createInfo.setPpEnabledLayerNames(s_expectedLayers.data());
-        }
-        else
-        {
-            assert(false);
-            createInfo.setEnabledLayerCount(0);
+            context.descriptors[i] = DescriptorSetBinding();
         }
 
-        auto createInstanceResult = vk::createInstance(createInfo);
-        VK_ASSERT(createInstanceResult);
-        s_instance  = createInstanceResult.value;
-
-        auto enumeratePhysicalDevicesResult = s_instance.enumeratePhysicalDevices();
-        VK_ASSERT(enumeratePhysicalDevicesResult);
-        s_physicalDevice = ChooseDevice(enumeratePhysicalDevicesResult.value);
-        s_physicalDeviceMemoryProperties = s_physicalDevice.getMemoryProperties();
-        s_physicalDeviceProperties = s_physicalDevice.getProperties();
-
-        // Create Surface
-        glfwCreateWindowSurface(s_instance, desc.window, nullptr, &s_surface);
-
-        /*
-        Create Queue Family
-        */
-        auto familyProperties = s_physicalDevice.getQueueFamilyProperties();
-        for (uint32_t i = 0; i < familyProperties.size(); i++)
+        // The Bindless Set Survives Pipeline Changes While Each Pipeline Has The Bindless Layout At That Set
+        if (context.bindlessSetIndex >= static_cast<int32_t>(compatibleSetCount))
         {
-            auto familyProp = familyProperties[i];
-            if (familyProp.queueFlags & vk::QueueFlagBits::eGraphics)
+            const auto& setLayouts = pipelineResource->m_descriptorSetLayouts;
+            if (static_cast<size_t>(context.bindlessSetIndex) < setLayouts.size() && setLayouts[context.bindlessSetIndex] == s_bindlessDescriptorSetLayout)
             {
-                s_graphicsFamily = i;
+                SetDescriptorSet(context, context.bindlessSetIndex, s_bindlessDescriptorSet, nullptr, 0);
             }
-
-            auto getSurfaceSupportKHRResult = s_physicalDevice.getSurfaceSupportKHR(i, s_surface);
-            VK_ASSERT(getSurfaceSupportKHRResult);
-            if (getSurfaceSupportKHRResult.value)
+            else
             {
-                s_presentFamily = i;
+                context.bindlessSetIndex = -1;
             }
         }
 
-        /*
-        Create Logical Device
-        */
+        context.pipeline = pipelineResource;
+        context.boundPipeline = pipelineResource->m_pipeline;
+        context.statistics.pipelineBinds++;
+
+        context.commandBuffer.bindPipeline(pipelineResource->m_bindPoint, pipelineResource->m_pipeline);
+    }
 
-        // Graphics Queue Create Info
-        vk::DeviceQueueCreateInfo graphicsQueueCreateInfo = {};
-        graphicsQueueCreateInfo.setQueueFamilyIndex(s_graphicsFamily);
-        graphicsQueueCreateInfo.setQueueCount(1);
-        float graphicsQueuePriority = 1.0f;
-        graphicsQueueCreateInfo.setPQueuePriorities(&graphicsQueuePriority);
+    void BindIndexBuffer(Buffer buffer, size_t offset, IndexType indexType)
+    {
+        if (s_recordingBundle)
+        {
+            s_recordingBundle->m_buffers.push_back(buffer.id);
+            s_recordingBundle->m_commands.push_back([=]() { BindIndexBuffer(buffer, offset, indexType); });
+            return;
+        }
 
-        // Presemt Queue Create Info
-        vk::DeviceQueueCreateInfo presentQueueCreateInfo = {};
-        presentQueueCreateInfo.setQueueFamilyIndex(s_presentFamily);
-        presentQueueCreateInfo.setQueueCount(1);
-        float presentQueuePriority = 1.0f;
-        presentQueueCreateInfo.setPQueuePriorities(&presentQueuePriority);
+        CommandContext& context = GetCommandContext();
+        BufferResource* bufferResource = s_bufferHandlePool.FetchResource(buffer.id);
+        vk::IndexType vkIndexType = MapIndexTypeFormatForVulkan(indexType);
 
-        std::vector<vk::DeviceQueueCreateInfo> queueCreateInfos = { graphicsQueueCreateInfo, presentQueueCreateInfo };
+        if (context.indexBuffer == bufferResource->m_buffer && context.indexBufferOffset == offset && context.indexType == vkIndexType)
+        {
+            context.statistics.redundantBufferBinds++;
+            return;
+        }
 
-        // Features
-        vk::PhysicalDeviceFeatures deviceFeatures = s_physicalDevice.getFeatures();
+        context.indexBuffer = bufferResource->m_buffer;
+        context.indexBufferOffset = offset;
+        context.indexType = vkIndexType;
 
-        // Device Create Info
-        vk::DeviceCreateInfo deviceCreateInfo = {};
-        deviceCreateInfo.setQueueCreateInfoCount(queueCreateInfos.size());
-        deviceCreateInfo.setPQueueCreateInfos(queueCreateInfos.data());
+        context.commandBuffer.bindIndexBuffer(bufferResource->m_buffer, offset, vkIndexType);
+    }
 
-        for (auto& pair : deviceExtensions)
+    void BindVertexBuffer(Buffer buffer, size_t offset, uint32_t binding)
+    {
+        assert(binding < MAX_VERTEX_BINDINGS);
+
+        if (s_recordingBundle)
         {
-            s_expectedExtensions.push_back(pair.second);
+            s_recordingBundle->m_buffers.push_back(buffer.id);
+            s_recordingBundle->m_commands.push_back([=]() { BindVertexBuffer(buffer, offset, binding); });
+            return;
         }
 
-        deviceCreateInfo.setEnabledExtensionCount(s_expectedExtensions.size());
-        deviceCreateInfo.setPpEnabledExtensionNames(s_expectedExtensions.data());
-        deviceCreateInfo.setPEnabledFeatures(&deviceFeatures);
+        CommandContext& context = GetCommandContext();
+        BufferResource* bufferResource = s_bufferHandlePool.FetchResource(buffer.id);
 
-        auto allDeviceExtensions = s_physicalDevice.enumerateDeviceExtensionProperties();
+        VertexBufferBinding& bound = context.vertexBuffers[binding];
+        if (bound.buffer == bufferResource->m_buffer && bound.offset == offset)
+        {
+            context.statistics.redundantBufferBinds++;
+            return;
+        }
 
-        auto createDeviceResult = s_physicalDevice.createDevice(deviceCreateInfo);
-        VK_ASSERT(createDeviceResult);
-        s_device = createDeviceResult.value;
+        bound.buffer = bufferResource->m_buffer;
+        bound.offset = offset;
 
-        // Create Default Queue
-        s_graphicsQueueDefault = s_device.getQueue(s_graphicsFamily, 0);
-        s_presentQueueDefault = s_device.getQueue(s_presentFamily, 0);
+        vk::DeviceSize vkOffset = {offset};
+        context.commandBuffer.bindVertexBuffers(binding, 1, &bufferResource->m_buffer, &vkOffset);
+    }
 
-        CreateSwapChain();
-        CreateImageViews();
-     
-        CreateCommandPoolDefault();
+    void BindVertexBuffers(uint32_t firstBinding, const std::vector<Buffer>& buffers, const std::vector<size_t>& offsets)
+    {
+        assert(!buffers.empty() && buffers.size() == offsets.size());
+        assert(firstBinding + buffers.size() <= MAX_VERTEX_BINDINGS);
 
-        ktxVulkanDeviceInfo_Construct(&s_ktx_device_info, s_physicalDevice, s_device, s_graphicsQueueDefault, s_commandPoolDefault, nullptr);
+        if (s_recordingBundle)
+        {
+            for (auto buffer : buffers)
+            {
+                s_recordingBundle->m_buffers.push_back(buffer.id);
+            }
+            s_recordingBundle->m_commands.push_back([=]() { BindVertexBuffers(firstBinding, buffers, offsets); });
+            return;
+        }
 
-        CreateCommandBuffersDefault();
-        CreateSyncObjects();
-        CreateDescriptorPoolDefault();
+        CommandContext& context = GetCommandContext();
 
-        for (auto extension : desc.extensions)
+        vk::Buffer vkBuffers[MAX_VERTEX_BINDINGS];
+        vk::DeviceSize vkOffsets[MAX_VERTEX_BINDINGS];
+        bool redundant = true;
+        for (size_t i = 0; i < buffers.size(); i++)
         {
-            if (extension == GFX::Extension::Raytracing)
+            BufferResource* bufferResource = s_bufferHandlePool.FetchResource(buffers[i].id);
+            vkBuffers[i] = bufferResource->m_buffer;
+            vkOffsets[i] = offsets[i];
+
+            VertexBufferBinding& bound = context.vertexBuffers[firstBinding + i];
+            if (bound.buffer != vkBuffers[i] || bound.offset != offsets[i])
             {
-                auto props = s_physicalDevice.getProperties2<vk::PhysicalDeviceProperties2, vk::PhysicalDeviceRayTracingPropertiesKHR>();
-                s_rayTracingProperties = props.get<vk::PhysicalDeviceRayTracingPropertiesKHR>();
+                redundant = false;
+                bound.buffer = vkBuffers[i];
+                bound.offset = offsets[i];
             }
         }
+
+        if (redundant)
+        {
+            context.statistics.redundantBufferBinds++;
+            return;
+        }
+
+        context.commandBuffer.bindVertexBuffers(firstBinding, buffers.size(), vkBuffers, vkOffsets);
     }
 
-    void Resize(int width, int height)
+    void Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
     {
-        RecreateSwapChain();
+        if (s_recordingBundle)
+        {
+            s_recordingBundle->m_commands.push_back([=]() { Draw(vertexCount, instanceCount, firstVertex, firstInstance); });
+            return;
+        }
+
+        CommandContext& context = GetCommandContext();
+        FlushDescriptorSets(context);
+        context.statistics.drawCalls++;
+
+        context.commandBuffer.draw(vertexCount, instanceCount, firstVertex, firstInstance);
     }
 
-    // resize all attachments
-    void ResizeRenderPass(RenderPass renderPass, int width, int height)
+    void DrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, uint32_t vertexOffset, uint32_t firstInstance)
     {
-        RenderPassResource* renderPassResource = s_renderPassHandlePool.FetchResource(renderPass.id);
-        renderPassResource->Resize(width, height);
+        if (s_recordingBundle)
+        {
+            s_recordingBundle->m_commands.push_back([=]() { DrawIndexed(indexCount, instanceCount, firstIndex, vertexOffset, firstInstance); });
+            return;
+        }
+
+        CommandContext& context = GetCommandContext();
+        FlushDescriptorSets(context);
+        context.statistics.drawCalls++;
+
+        context.commandBuffer.drawIndexed(indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     }
 
-    bool BeginFrame()
+    void DrawIndirect(Buffer buffer, size_t offset, uint32_t drawCount, uint32_t stride)
     {
-        s_device.waitForFences(1, &s_inFlightFences[s_currentFrame], false, UINT64_MAX);
-        s_device.resetFences(1, &s_inFlightFences[s_currentFrame]);
+        assert(drawCount <= 1 || s_multiDrawIndirectEnabled);
 
-        auto acquireNextImageResult = s_device.acquireNextImageKHR(s_swapChain, UINT64_MAX, s_imageAvailableSemaphores[s_currentFrame], nullptr);
-        
-        if (acquireNextImageResult.result == vk::Result::eErrorOutOfDateKHR || acquireNextImageResult.result == vk::Result::eSuboptimalKHR)
+        if (s_recordingBundle)
         {
-            printf("Inline Resize \n");
-            RecreateSwapChain();
-            return false;
+            s_recordingBundle->m_buffers.push_back(buffer.id);
+            s_recordingBundle->m_commands.push_back([=]() { DrawIndirect(buffer, offset, drawCount, stride); });
+            return;
         }
-        else
+
+        CommandContext& context = GetCommandContext();
+        BufferResource* bufferResource = s_bufferHandlePool.FetchResource(buffer.id);
+        assert(bufferResource->m_usage == BufferUsage::IndirectBuffer);
+
+        FlushDescriptorSets(context);
+        context.statistics.drawCalls++;
+        context.statistics.indirectDrawCalls++;
+
+        context.commandBuffer.drawIndirect(bufferResource->m_buffer, offset, drawCount, stride);
+    }
+
+    void DrawIndexedIndirect(Buffer buffer, size_t offset, uint32_t drawCount, uint32_t stride)
+    {
+        assert(drawCount <= 1 || s_multiDrawIndirectEnabled);
+
+        if (s_recordingBundle)
         {
-            VK_ASSERT(acquireNextImageResult);
+            s_recordingBundle->m_buffers.push_back(buffer.id);
+            s_recordingBundle->m_commands.push_back([=]() { DrawIndexedIndirect(buffer, offset, drawCount, stride); });
+            return;
         }
 
-        s_currentImageIndex = acquireNextImageResult.value;
+        CommandContext& context = GetCommandContext();
+        BufferResource* bufferResource = s_bufferHandlePool.FetchResource(buffer.id);
+        assert(bufferResource->m_usage == BufferUsage::IndirectBuffer);
 
-        vk::CommandBufferBeginInfo commandBufferBeginInfo = {};
-        commandBufferBeginInfo.setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit);
+        FlushDescriptorSets(context);
+        context.statistics.drawCalls++;
+        context.statistics.indirectDrawCalls++;
 
-        auto commandBufferBeginResult = s_commandBuffersDefault[s_currentImageIndex].begin(commandBufferBeginInfo);
-        assert(commandBufferBeginResult == vk::Result::eSuccess);
-        return true;
+        context.commandBuffer.drawIndexedIndirect(bufferResource->m_buffer, offset, drawCount, stride);
     }
 
-    /*void BeginDefaultRenderPass()
+    void DrawIndirectCount(Buffer buffer, size_t offset, Buffer countBuffer, size_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
     {
-        vk::RenderPassBeginInfo renderPassBeginInfo = {};
-        
-        renderPassBeginInfo.setRenderPass(s_renderPassDefault);
-        renderPassBeginInfo.setFramebuffer(s_swapChainFrameBuffers[s_currentImageIndex]);
-        
-        vk::Rect2D area = {};
-        area.setExtent(s_swapChainImageExtent);
-        area.setOffset({ 0, 0 });
-        renderPassBeginInfo.setRenderArea(area);
+        assert(s_drawIndirectCountEnabled);
 
-        vk::ClearColorValue colorValue = {};
-        colorValue.setFloat32({ 0.0f, 0.0f, 0.0f, 1.0f });
-        vk::ClearValue clearColor = {};
-        clearColor.setColor(colorValue);
+        if (s_recordingBundle)
+        {
+            s_recordingBundle->m_buffers.push_back(buffer.id);
+            s_recordingBundle->m_buffers.push_back(countBuffer.id);
+            s_recordingBundle->m_commands.push_back([=]() { DrawIndirectCount(buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride); });
+            return;
+        }
 
-        vk::ClearValue clearDepthStencil = {};
-        clearDepthStencil.setDepthStencil({ 1.0f, 0 });
+        CommandContext& context = GetCommandContext();
+        BufferResource* bufferResource = s_bufferHandlePool.FetchResource(buffer.id);
+        BufferResource* countBufferResource = s_bufferHandlePool.FetchResource(countBuffer.id);
+        assert(bufferResource->m_usage == BufferUsage::IndirectBuffer);
+        assert(countBufferResource->m_usage == BufferUsage::IndirectBuffer);
 
-        std::vector<vk::ClearValue> clearValues = { clearColor, clearDepthStencil };
+        FlushDescriptorSets(context);
+        context.statistics.drawCalls++;
+        context.statistics.indirectDrawCalls++;
 
-        renderPassBeginInfo.setClearValueCount(clearValues.size());
-        renderPassBeginInfo.setPClearValues(clearValues.data());
-        
-        s_commandBuffersDefault[s_currentImageIndex].beginRenderPass(renderPassBeginInfo, vk::SubpassContents::eInline);
-    }*/
+        context.commandBuffer.drawIndirectCount(bufferResource->m_buffer, offset, countBufferResource->m_buffer, countBufferOffset, maxDrawCount, stride);
+    }
 
-    void BeginRenderPass(RenderPass renderPass, int offsetX, int offsetY, int width, int height)
+    void DrawIndexedIndirectCount(Buffer buffer, size_t offset, Buffer countBuffer, size_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
     {
-        auto renderPassResource = s_renderPassHandlePool.FetchResource(renderPass.id);
-        
-        vk::RenderPassBeginInfo renderPassBeginInfo = {};
+        assert(s_drawIndirectCountEnabled);
 
-        renderPassBeginInfo.setRenderPass(renderPassResource->m_renderPass);
-        renderPassBeginInfo.setFramebuffer(renderPassResource->m_framebuffers[s_currentImageIndex]);
-        renderPassBeginInfo.setClearValueCount(renderPassResource->m_clearValues.size());
-        renderPassBeginInfo.setPClearValues(renderPassResource->m_clearValues.data());
+        if (s_recordingBundle)
+        {
+            s_recordingBundle->m_buffers.push_back(buffer.id);
+            s_recordingBundle->m_buffers.push_back(countBuffer.id);
+            s_recordingBundle->m_commands.push_back([=]() { DrawIndexedIndirectCount(buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride); });
+            return;
+        }
 
-        vk::Rect2D rect = {};
-        rect.setOffset({ offsetX, offsetY });
-        rect.setExtent({ (uint32_t)width, (uint32_t)height });
-        renderPassBeginInfo.setRenderArea(rect);
+        CommandContext& context = GetCommandContext();
+        BufferResource* bufferResource = s_bufferHandlePool.FetchResource(buffer.id);
+        BufferResource* countBufferResource = s_bufferHandlePool.FetchResource(countBuffer.id);
+        assert(bufferResource->m_usage == BufferUsage::IndirectBuffer);
+        assert(countBufferResource->m_usage == BufferUsage::IndirectBuffer);
 
-        s_commandBuffersDefault[s_currentImageIndex].beginRenderPass(renderPassBeginInfo, vk::SubpassContents::eInline);
+        FlushDescriptorSets(context);
+        context.statistics.drawCalls++;
+        context.statistics.indirectDrawCalls++;
+
+        context.commandBuffer.drawIndexedIndirectCount(bufferResource->m_buffer, offset, countBufferResource->m_buffer, countBufferOffset, maxDrawCount, stride);
     }
 
-    void NextSubpass()
+    bool IsDrawIndirectCountSupported()
     {
-        s_commandBuffersDefault[s_currentImageIndex].nextSubpass(vk::SubpassContents::eInline);
+        return s_drawIndirectCountEnabled;
     }
 
-    void EndRenderPass()
+    bool IsMultiDrawIndirectSupported()
     {
-        s_commandBuffersDefault[s_currentImageIndex].endRenderPass();
+        return s_multiDrawIndirectEnabled;
     }
 
-    void EndFrame()
+    void Dispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
     {
-        s_commandBuffersDefault[s_currentImageIndex].end();
+        assert(!s_insideRenderPass && !s_recordingBundle && !s_threadContext);
 
-        /*
-        Submit Commands
-        */
-        vk::SubmitInfo submitInfo = {};
-        
-        static vk::PipelineStageFlags waitStages[] = { vk::PipelineStageFlagBits::eColorAttachmentOutput };
+        CommandContext& context = GetCommandContext();
+        assert(context.pipeline && context.pipeline->m_bindPoint == vk::PipelineBindPoint::eCompute);
 
-        submitInfo.setWaitSemaphoreCount(1);
-        submitInfo.setPWaitSemaphores(&s_imageAvailableSemaphores[s_currentFrame]);
-        submitInfo.setPWaitDstStageMask(waitStages);
-        submitInfo.setCommandBufferCount(1);
-        submitInfo.setPCommandBuffers(&s_commandBuffersDefault[s_currentImageIndex]);
-        submitInfo.setSignalSemaphoreCount(1);
-        submitInfo.setPSignalSemaphores(&s_renderFinishedSemaphores[s_currentFrame]);
+        FlushDescriptorSets(context);
+        context.statistics.dispatchCalls++;
 
-        s_device.resetFences(s_inFlightFences[s_currentFrame]);
-        auto submitResult = s_graphicsQueueDefault.submit(submitInfo, s_inFlightFences[s_currentFrame]);
-        assert(submitResult == vk::Result::eSuccess);
+        context.commandBuffer.dispatch(groupCountX, groupCountY, groupCountZ);
+    }
 
-        vk::PresentInfoKHR presentInfo = {};
-        presentInfo.setWaitSemaphoreCount(1);
-        presentInfo.setPWaitSemaphores(&s_renderFinishedSemaphores[s_currentFrame]);
-        presentInfo.setPSwapchains(&s_swapChain);
-        presentInfo.setPImageIndices(&s_currentImageIndex);
-        presentInfo.setSwapchainCount(1);
+    void DispatchIndirect(Buffer buffer, size_t offset)
+    {
+        assert(!s_insideRenderPass && !s_recordingBundle && !s_threadContext);
 
-        auto presentResult = s_presentQueueDefault.presentKHR(presentInfo);
-        if (presentResult == vk::Result::eErrorOutOfDateKHR || presentResult == vk::Result::eSuboptimalKHR)
-        {
-            printf("Inline Resize \n");
-            RecreateSwapChain();
-        }
-        else
-        {
-            assert(presentResult == vk::Result::eSuccess);
-        }
+        CommandContext& context = GetCommandContext();
+        assert(context.pipeline && context.pipeline->m_bindPoint == vk::PipelineBindPoint::eCompute);
 
-        s_currentFrame = (s_currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+        BufferResource* bufferResource = s_bufferHandlePool.FetchResource(buffer.id);
+        assert(bufferResource->m_usage == BufferUsage::IndirectBuffer);
+
+        FlushDescriptorSets(context);
+        context.statistics.dispatchCalls++;
+
+        context.commandBuffer.dispatchIndirect(bufferResource->m_buffer, offset);
     }
 
-    void Shutdown()
+    void BufferBarrier(Buffer buffer, PipelineStage srcStage, Access srcAccess, PipelineStage dstStage, Access dstAccess)
+    {
+        assert(!s_insideRenderPass && !s_recordingBundle && !s_threadContext);
+
+        BufferResource* bufferResource = s_bufferHandlePool.FetchResource(buffer.id);
+
+        vk::BufferMemoryBarrier barrier = {};
+        barrier.setSrcAccessMask(MapAcessForVulkan(srcAccess));
+        barrier.setDstAccessMask(MapAcessForVulkan(dstAccess));
+        barrier.setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED);
+        barrier.setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED);
+        barrier.setBuffer(bufferResource->m_buffer);
+        barrier.setOffset(0);
+        barrier.setSize(VK_WHOLE_SIZE);
+
+        GetCommandContext().commandBuffer.pipelineBarrier(MapPipelineStageForVulkan(srcStage), MapPipelineStageForVulkan(dstStage), {}, nullptr, barrier, nullptr);
+    }
+
+    void FillBuffer(Buffer buffer, size_t offset, size_t size, uint32_t value)
+    {
+        assert(!s_insideRenderPass && !s_recordingBundle && !s_threadContext);
+
+        // Only Static Buffers Are Created As Transfer Destinations
+        BufferResource* bufferResource = s_bufferHandlePool.FetchResource(buffer.id);
+        assert(bufferResource->m_storageMode == BufferStorageMode::Static);
+        assert(offset % 4 == 0 && size % 4 == 0 && offset + size <= bufferResource->m_size);
+
+        GetCommandContext().commandBuffer.fillBuffer(bufferResource->m_buffer, offset, size, value);
+    }
+
+    void ImageBarrier(Image image, ImageLayout oldLayout, ImageLayout newLayout, PipelineStage srcStage, Access srcAccess, PipelineStage dstStage, Access dstAccess)
+    {
+        assert(!s_insideRenderPass && !s_recordingBundle && !s_threadContext);
+
+        ImageResource* imageResource = s_imageHandlePool.FetchResource(image.id);
+
+        vk::ImageSubresourceRange subresourceRange = {};
+        subresourceRange.setAspectMask(vk::ImageAspectFlagBits::eColor);
+        subresourceRange.setBaseMipLevel(0);
+        subresourceRange.setLevelCount(VK_REMAINING_MIP_LEVELS);
+        subresourceRange.setBaseArrayLayer(0);
+        subresourceRange.setLayerCount(imageResource->m_layerCount);
+
+        vk::ImageMemoryBarrier barrier = {};
+        barrier.setSrcAccessMask(MapAcessForVulkan(srcAccess));
+        barrier.setDstAccessMask(MapAcessForVulkan(dstAccess));
+        barrier.setOldLayout(MapImageLayoutForVulkan(oldLayout));
+        barrier.setNewLayout(MapImageLayoutForVulkan(newLayout));
+        barrier.setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED);
+        barrier.setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED);
+        barrier.setImage(imageResource->m_image);
+        barrier.setSubresourceRange(subresourceRange);
+
+        GetCommandContext().commandBuffer.pipelineBarrier(MapPipelineStageForVulkan(srcStage), MapPipelineStageForVulkan(dstStage), {}, nullptr, nullptr, barrier);
+    }
+
+    CommandContext& GetCommandContext()
+    {
+        return s_threadContext ? *s_threadContext : s_frameContext;
+    }
+
+    bool IsPushConstantRangeDeclared(const PipelineResource* pipeline, vk::ShaderStageFlags stages, uint32_t offset, uint32_t size)
+    {
+        for (const auto& range : pipeline->m_pushConstantRanges)
+        {
+            if ((range.stageFlags & stages) == stages && offset >= range.offset && offset + size <= range.offset + range.size)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    uint32_t GetCompatibleSetCount(const PipelineResource* previous, const PipelineResource* next)
+    {
+        if (!previous)
+        {
+            return 0;
+        }
+
+        if (previous->m_pipelineLayout == next->m_pipelineLayout)
+        {
+            return MAX_DESCRIPTOR_SETS;
+        }
+
+        // Each Bind Point Has Its Own Sets, Layouts With Different Push Constant Ranges Are Not Compatible For Any Set
+        if (previous->m_bindPoint != next->m_bindPoint || previous->m_pushConstantRanges != next->m_pushConstantRanges)
+        {
+            return 0;
+        }
+
+        uint32_t count = 0;
+        while (count < previous->m_descriptorSetLayouts.size() && count < next->m_descriptorSetLayouts.size() && previous->m_descriptorSetLayouts[count] == next->m_descriptorSetLayouts[count])
+        {
+            count++;
+        }
+
+        return count;
+    }
+
+    void SetDescriptorSet(CommandContext& context, uint32_t set, vk::DescriptorSet descriptorSet, const uint32_t* dynamicOffsets, uint32_t dynamicOffsetCount)
+    {
+        assert(set < MAX_DESCRIPTOR_SETS);
+        assert(dynamicOffsetCount <= MAX_DYNAMIC_OFFSETS_PER_SET);
+
+        DescriptorSetBinding& binding = context.descriptors[set];
+
+        bool unchanged = binding.descriptorSet == descriptorSet && binding.dynamicOffsetCount == dynamicOffsetCount;
+        for (uint32_t i = 0; unchanged && i < dynamicOffsetCount; i++)
+        {
+            unchanged = binding.dynamicOffsets[i] == dynamicOffsets[i];
+        }
+
+        if (unchanged)
+        {
+            context.statistics.redundantDescriptorSetBinds++;
+            return;
+        }
+
+        binding.descriptorSet = descriptorSet;
+        binding.dynamicOffsetCount = dynamicOffsetCount;
+        for (uint32_t i = 0; i < dynamicOffsetCount; i++)
+        {
+            binding.dynamicOffsets[i] = dynamicOffsets[i];
+        }
+
+        context.dirtySetBegin = std::min(context.dirtySetBegin, set);
+        context.dirtySetEnd = std::max(context.dirtySetEnd, set + 1);
+    }
+
+    void FlushDescriptorSets(CommandContext& context)
+    {
+        // Bind Each Contiguous Run Of Requested Sets Inside The Dirty Range
+        uint32_t set = context.dirtySetBegin;
+        while (set < context.dirtySetEnd)
+        {
+            if (!context.descriptors[set].descriptorSet)
+            {
+                set++;
+                continue;
+            }
+
+            vk::DescriptorSet descriptorSets[MAX_DESCRIPTOR_SETS];
+            uint32_t dynamicOffsets[MAX_DESCRIPTOR_SETS * MAX_DYNAMIC_OFFSETS_PER_SET];
+            uint32_t descriptorSetCount = 0;
+            uint32_t dynamicOffsetCount = 0;
+
+            uint32_t firstSet = set;
+            while (set < context.dirtySetEnd && context.descriptors[set].descriptorSet)
+            {
+                const DescriptorSetBinding& binding = context.descriptors[set];
+                descriptorSets[descriptorSetCount++] = binding.descriptorSet;
+                for (uint32_t i = 0; i < binding.dynamicOffsetCount; i++)
+                {
+                    dynamicOffsets[dynamicOffsetCount++] = binding.dynamicOffsets[i];
+                }
+                set++;
+            }
+
+            context.commandBuffer.bindDescriptorSets(context.pipeline->m_bindPoint, context.pipeline->m_pipelineLayout, firstSet, descriptorSetCount, descriptorSets, dynamicOffsetCount, dynamicOffsets);
+
+            context.statistics.descriptorSetBindCalls++;
+            context.statistics.descriptorSetsBound += descriptorSetCount;
+        }
+
+        context.dirtySetBegin = MAX_DESCRIPTOR_SETS;
+        context.dirtySetEnd = 0;
+    }
+
+    void AccumulateRenderStatistics(RenderStatistics& target, const RenderStatistics& source)
+    {
+        target.drawCalls += source.drawCalls;
+        target.descriptorSetBindCalls += source.descriptorSetBindCalls;
+        target.descriptorSetsBound += source.descriptorSetsBound;
+        target.redundantDescriptorSetBinds += source.redundantDescriptorSetBinds;
+        target.commandListsExecuted += source.commandListsExecuted;
+        target.pipelineBinds += source.pipelineBinds;
+        target.redundantPipelineBinds += source.redundantPipelineBinds;
+        target.redundantBufferBinds += source.redundantBufferBinds;
+        target.redundantDynamicStates += source.redundantDynamicStates;
+        target.renderBundlesExecuted += source.renderBundlesExecuted;
+        target.indirectDrawCalls += source.indirectDrawCalls;
+        target.dispatchCalls += source.dispatchCalls;
+    }
+
+    void PushConstants(ShaderStage stage, uint32_t offset, uint32_t size, const void* data)
+    {
+        // Vulkan Guarantees 128 Bytes, Larger Ranges Depend On The Device
+        assert(offset + size <= s_physicalDeviceProperties.limits.maxPushConstantsSize);
+
+        if (s_recordingBundle)
+        {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            std::vector<uint8_t> constants(bytes, bytes + size);
+            s_recordingBundle->m_commands.push_back([=]() { PushConstants(stage, offset, size, constants.data()); });
+            return;
+        }
+
+        CommandContext& context = GetCommandContext();
+        // Executing Command Lists Or Bundles Resets The Bound State, Apply The Pipeline Again After Them
+        assert(context.pipeline && "PushConstants: no pipeline applied");
+        assert(IsPushConstantRangeDeclared(context.pipeline, MapShaderStageForVulkan(stage), offset, size) && "PushConstants: range not declared for this stage in the pipeline");
+
+        context.commandBuffer.pushConstants(context.pipeline->m_pipelineLayout, MapShaderStageForVulkan(stage), offset, size, data);
+    }
+
+    void SetViewport(float x, float y, float w, float h)
+    {
+        if (s_recordingBundle)
+        {
+            s_recordingBundle->m_commands.push_back([=]() { SetViewport(x, y, w, h); });
+            return;
+        }
+
+        vk::Viewport newViewport = {};
+        newViewport.setX(x);
+        newViewport.setY(y);
+        newViewport.setWidth(w);
+        newViewport.setHeight(h);
+        newViewport.setMinDepth(0.0f);
+        newViewport.setMaxDepth(1.0f);
+
+        CommandContext& context = GetCommandContext();
+        if (context.viewportValid && context.viewport == newViewport)
+        {
+            context.statistics.redundantDynamicStates++;
+            return;
+        }
+
+        context.viewport = newViewport;
+        context.viewportValid = true;
+
+        context.commandBuffer.setViewport(0, 1, &newViewport);
+    }
+
+    void SetScissor(float x, float y, float w, float h)
+    {
+        if (s_recordingBundle)
+        {
+            s_recordingBundle->m_commands.push_back([=]() { SetScissor(x, y, w, h); });
+            return;
+        }
+
+        vk::Rect2D scissor = {};
+        scissor.setOffset({ static_cast<int32_t>(x), static_cast<int32_t>(y) });
+        scissor.setExtent({ static_cast<uint32_t>(w), static_cast<uint32_t>(h) });
+
+        CommandContext& context = GetCommandContext();
+        if (context.scissorValid && context.scissor == scissor)
+        {
+            context.statistics.redundantDynamicStates++;
+            return;
+        }
+
+        context.scissor = scissor;
+        context.scissorValid = true;
+
+        context.commandBuffer.setScissor(0, scissor);
+    }
+
+    /*
+    Command Lists
+    */
+    CommandList BeginCommandList(RenderPass renderPass, uint32_t subpass)
+    {
+        assert(s_frameRecording);
+
+        ThreadCommandPool* threadPool = GetThreadCommandPool();
+        assert(threadPool->recordingList == 0);
+
+        uint32_t frame = s_currentFrame;
+        if (threadPool->usedCommandBuffers[frame] == threadPool->commandBuffers[frame].size())
+        {
+            vk::CommandBufferAllocateInfo commandBufferAllocateInfo = {};
+            commandBufferAllocateInfo.setCommandPool(threadPool->commandPools[frame]);
+            commandBufferAllocateInfo.setLevel(vk::CommandBufferLevel::eSecondary);
+            commandBufferAllocateInfo.setCommandBufferCount(1);
+
+            auto allocateCommandBuffersResult = s_device.allocateCommandBuffers(commandBufferAllocateInfo);
+            VK_ASSERT(allocateCommandBuffersResult);
+            threadPool->commandBuffers[frame].push_back(allocateCommandBuffersResult.value[0]);
+        }
+
+        vk::CommandBuffer commandBuffer = threadPool->commandBuffers[frame][threadPool->usedCommandBuffers[frame]++];
+
+        RenderPassResource* renderPassResource = s_renderPassHandlePool.FetchResource(renderPass.id);
+
+        vk::CommandBufferInheritanceInfo inheritanceInfo = {};
+        inheritanceInfo.setRenderPass(renderPassResource->m_renderPass);
+        inheritanceInfo.setSubpass(subpass);
+        inheritanceInfo.setFramebuffer(renderPassResource->m_framebuffers[s_currentImageIndex]);
+
+        vk::CommandBufferBeginInfo commandBufferBeginInfo = {};
+        commandBufferBeginInfo.setFlags(vk::CommandBufferUsageFlagBits::eRenderPassContinue | vk::CommandBufferUsageFlagBits::eOneTimeSubmit);
+        commandBufferBeginInfo.setPInheritanceInfo(&inheritanceInfo);
+
+        auto commandBufferBeginResult = commandBuffer.begin(commandBufferBeginInfo);
+        assert(commandBufferBeginResult == vk::Result::eSuccess);
+
+        CommandList result = CommandList();
+        {
+            std::lock_guard<std::mutex> lock(s_commandListMutex);
+
+            CommandListRecord record = {};
+            record.commandBuffer = commandBuffer;
+            s_commandLists.push_back(record);
+
+            result.id = s_commandLists.size();
+        }
+
+        threadPool->context = CommandContext();
+        threadPool->context.commandBuffer = commandBuffer;
+        threadPool->recordingList = result.id;
+        s_threadContext = &threadPool->context;
+
+        return result;
+    }
+
+    void EndCommandList(CommandList commandList)
+    {
+        ThreadCommandPool* threadPool = s_threadCommandPool.pool;
+        assert(threadPool && threadPool->recordingList == commandList.id);
+
+        threadPool->context.commandBuffer.end();
+
+        {
+            std::lock_guard<std::mutex> lock(s_commandListMutex);
+
+            CommandListRecord& record = s_commandLists[commandList.id - 1];
+            record.statistics = threadPool->context.statistics;
+            record.ended = true;
+        }
+
+        threadPool->recordingList = 0;
+        s_threadContext = nullptr;
+    }
+
+    void ExecuteCommandLists(const std::vector<CommandList>& commandLists)
+    {
+        assert(s_threadContext == nullptr);
+
+        std::vector<vk::CommandBuffer> commandBuffers;
+        {
+            std::lock_guard<std::mutex> lock(s_commandListMutex);
+
+            for (auto commandList : commandLists)
+            {
+                const CommandListRecord& record = s_commandLists[commandList.id - 1];
+                assert(record.ended);
+
+                commandBuffers.push_back(record.commandBuffer);
+                AccumulateRenderStatistics(s_frameContext.statistics, record.statistics);
+                s_frameContext.statistics.commandListsExecuted++;
+            }
+        }
+
+        if (commandBuffers.size() > 0)
+        {
+            s_commandBuffersDefault[s_currentImageIndex].executeCommands(commandBuffers);
+        }
+
+        ResetBoundState(s_frameContext);
+    }
+
+    void ResetBoundState(CommandContext& context)
+    {
+        // State Bound On The Primary Buffer Is Undefined After Executing Secondary Buffers
+        CommandContext resetContext = CommandContext();
+        resetContext.commandBuffer = context.commandBuffer;
+        resetContext.statistics = context.statistics;
+        context = resetContext;
+    }
+
+    /*
+    Render Bundles
+    */
+    RenderBundle BeginRenderBundle(RenderPass renderPass, uint32_t subpass)
+    {
+        assert(s_recordingBundle == nullptr && s_threadContext == nullptr);
+
+        RenderBundle result = RenderBundle();
+        result.id = s_renderBundleHandlePool.Allocate(renderPass, subpass);
+
+        RenderBundleResource* bundle = s_renderBundleHandlePool.FetchResource(result.id);
+        bundle->handle = result.id;
+        s_renderBundles.push_back(result.id);
+
+        s_recordingBundle = bundle;
+        return result;
+    }
+
+    void EndRenderBundle(RenderBundle renderBundle)
+    {
+        RenderBundleResource* bundle = s_renderBundleHandlePool.FetchResource(renderBundle.id);
+        assert(s_recordingBundle == bundle);
+        s_recordingBundle = nullptr;
+
+        std::vector<uint32_t>* dependencies[] = { &bundle->m_pipelines, &bundle->m_buffers, &bundle->m_uniforms };
+        for (auto handles : dependencies)
+        {
+            std::sort(handles->begin(), handles->end());
+            handles->erase(std::unique(handles->begin(), handles->end()), handles->end());
+        }
+    }
+
+    bool IsRenderBundleValid(RenderBundle renderBundle)
+    {
+        return s_renderBundleHandlePool.IsValid(renderBundle.id) && s_renderBundleHandlePool.FetchResource(renderBundle.id)->m_valid;
+    }
+
+    void ExecuteRenderBundle(RenderBundle renderBundle)
+    {
+        assert(s_recordingBundle == nullptr && s_threadContext == nullptr);
+
+        RenderBundleResource* bundle = s_renderBundleHandlePool.FetchResource(renderBundle.id);
+        assert(bundle->m_valid);
+
+        // Swap Chain Recreation May Change The Image Count
+        if (bundle->m_commandBuffers.size() != s_swapChainImages.size())
+        {
+            bundle->ReleaseCommandBuffers();
+            bundle->m_commandBuffers.resize(s_swapChainImages.size());
+        }
+
+        if (!bundle->m_commandBuffers[s_currentImageIndex])
+        {
+            RecordRenderBundle(bundle);
+        }
+
+        s_commandBuffersDefault[s_currentImageIndex].executeCommands(1, &bundle->m_commandBuffers[s_currentImageIndex]);
+
+        AccumulateRenderStatistics(s_frameContext.statistics, bundle->m_statistics);
+        s_frameContext.statistics.renderBundlesExecuted++;
+
+        ResetBoundState(s_frameContext);
+    }
+
+    void RecordRenderBundle(RenderBundleResource* bundle)
+    {
+        if (!s_renderBundleCommandPool)
+        {
+            vk::CommandPoolCreateInfo commandPoolCreateInfo = {};
+            commandPoolCreateInfo.setQueueFamilyIndex(s_graphicsFamily);
+
+            auto createCommandPoolResult = s_device.createCommandPool(commandPoolCreateInfo);
+            VK_ASSERT(createCommandPoolResult);
+            s_renderBundleCommandPool = createCommandPoolResult.value;
+        }
+
+        vk::CommandBufferAllocateInfo commandBufferAllocateInfo = {};
+        commandBufferAllocateInfo.setCommandPool(s_renderBundleCommandPool);
+        commandBufferAllocateInfo.setLevel(vk::CommandBufferLevel::eSecondary);
+        commandBufferAllocateInfo.setCommandBufferCount(1);
+
+        auto allocateCommandBuffersResult = s_device.allocateCommandBuffers(commandBufferAllocateInfo);
+        VK_ASSERT(allocateCommandBuffersResult);
+        vk::CommandBuffer commandBuffer = allocateCommandBuffersResult.value[0];
+        bundle->m_commandBuffers[s_currentImageIndex] = commandBuffer;
+
+        RenderPassResource* renderPassResource = s_renderPassHandlePool.FetchResource(bundle->m_renderPass.id);
+
+        vk::CommandBufferInheritanceInfo inheritanceInfo = {};
+        inheritanceInfo.setRenderPass(renderPassResource->m_renderPass);
+        inheritanceInfo.setSubpass(bundle->m_subpass);
+        inheritanceInfo.setFramebuffer(renderPassResource->m_framebuffers[s_currentImageIndex]);
+
+        vk::CommandBufferBeginInfo commandBufferBeginInfo = {};
+        commandBufferBeginInfo.setFlags(vk::CommandBufferUsageFlagBits::eRenderPassContinue);
+        commandBufferBeginInfo.setPInheritanceInfo(&inheritanceInfo);
+
+        auto commandBufferBeginResult = commandBuffer.begin(commandBufferBeginInfo);
+        assert(commandBufferBeginResult == vk::Result::eSuccess);
+
+        CommandContext context = CommandContext();
+        context.commandBuffer = commandBuffer;
+        s_threadContext = &context;
+
+        // Dynamic State Is Not Inherited, Default To The Whole Render Pass So Bundles Follow Resizes
+        SetViewport(0, 0, renderPassResource->m_width, renderPassResource->m_height);
+        SetScissor(0, 0, renderPassResource->m_width, renderPassResource->m_height);
+
+        for (auto& command : bundle->m_commands)
+        {
+            command();
+        }
+
+        s_threadContext = nullptr;
+        commandBuffer.end();
+
+        bundle->m_statistics = context.statistics;
+    }
+
+    void InvalidateRenderBundles(uint32_t handle, std::vector<uint32_t> RenderBundleResource::* dependencies)
+    {
+        for (auto bundleHandle : s_renderBundles)
+        {
+            RenderBundleResource* bundle = s_renderBundleHandlePool.FetchResource(bundleHandle);
+            const std::vector<uint32_t>& handles = bundle->*dependencies;
+            if (std::binary_search(handles.begin(), handles.end(), handle))
+            {
+                bundle->Invalidate();
+            }
+        }
+    }
+
+    void DestroyRenderBundleResources()
+    {
+        if (s_renderBundleCommandPool)
+        {
+            s_device.destroyCommandPool(s_renderBundleCommandPool);
+            s_renderBundleCommandPool = nullptr;
+        }
+    }
+
+    ThreadCommandPool* GetThreadCommandPool()
+    {
+        // Recording Never Overlaps Init Or Shutdown, Reading The Epoch Without The Lock Is Safe Here
+        if (s_threadCommandPool.pool && s_threadCommandPool.epoch == s_threadCommandPoolEpoch)
+        {
+            return s_threadCommandPool.pool;
+        }
+
+        std::lock_guard<std::mutex> lock(s_commandListMutex);
+
+        ThreadCommandPool* threadPool = nullptr;
+        if (!s_freeThreadCommandPools.empty())
+        {
+            threadPool = s_freeThreadCommandPools.back();
+            s_freeThreadCommandPools.pop_back();
+        }
+        else
+        {
+            threadPool = new ThreadCommandPool();
+            for (uint32_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
+            {
+                vk::CommandPoolCreateInfo commandPoolCreateInfo = {};
+                commandPoolCreateInfo.setQueueFamilyIndex(s_graphicsFamily);
+
+                auto createCommandPoolResult = s_device.createCommandPool(commandPoolCreateInfo);
+                VK_ASSERT(createCommandPoolResult);
+                threadPool->commandPools[i] = createCommandPoolResult.value;
+            }
+
+            s_threadCommandPools.push_back(threadPool);
+        }
+
+        s_threadCommandPool.pool = threadPool;
+        s_threadCommandPool.epoch = s_threadCommandPoolEpoch;
+        return threadPool;
+    }
+
+    void ResetThreadCommandPools(uint32_t frame)
+    {
+        std::lock_guard<std::mutex> lock(s_commandListMutex);
+
+        // Called Right After The Frame's Fence Wait, Before Any Thread Records Into This Slot Again
+        for (auto threadPool : s_threadCommandPools)
+        {
+            s_device.resetCommandPool(threadPool->commandPools[frame], {});
+            threadPool->usedCommandBuffers[frame] = 0;
+        }
+
+        s_commandLists.clear();
+    }
+
+    void DestroyThreadCommandPools()
+    {
+        std::lock_guard<std::mutex> lock(s_commandListMutex);
+
+        for (auto threadPool : s_threadCommandPools)
+        {
+            for (uint32_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
+            {
+                s_device.destroyCommandPool(threadPool->commandPools[i]);
+            }
+            delete threadPool;
+        }
+
+        s_threadCommandPools.clear();
+        s_freeThreadCommandPools.clear();
+        s_commandLists.clear();
+        s_threadCommandPool.pool = nullptr;
+        // Other Threads Still Point At The Deleted Pools, The New Epoch Makes Them Ignore Those Pointers
+        s_threadCommandPoolEpoch++;
+    }
+
+    /*
+    Life Cycle
+    */
+
+    void Init(const InitialDescription& desc)
+    {
+        std::map<const char*, const char*> instanceExtensions;
+        std::map<const char*, const char*> deviceExtensions;
+
+        for (auto extensionName : s_expectedExtensions)
+        {
+            deviceExtensions[extensionName] = extensionName;
+        }
+
+        for (auto extension : desc.extensions)
+        {
+            if (extension == GFX::Extension::Raytracing)
+            {
+                instanceExtensions[VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME] = VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME;
+                deviceExtensions[VK_KHR_RAY_TRACING_EXTENSION_NAME] = VK_KHR_RAY_TRACING_EXTENSION_NAME;
+                deviceExtensions[VK_KHR_MAINTENANCE3_EXTENSION_NAME] = VK_KHR_MAINTENANCE3_EXTENSION_NAME;
+                deviceExtensions[VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME] = VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME;
+                deviceExtensions[VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME] = VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME;
+                deviceExtensions[VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME] = VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME;
+                s_bufferDeviceAddressEnabled = true;
+            }
+            else if (extension == GFX::Extension::Bindless)
+            {
+                instanceExtensions[VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME] = VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME;
+                deviceExtensions[VK_KHR_MAINTENANCE3_EXTENSION_NAME] = VK_KHR_MAINTENANCE3_EXTENSION_NAME;
+                deviceExtensions[VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME] = VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME;
+                s_bindlessEnabled = true;
+            }
+        }
+
+        auto enumerateInstanceExtensionPropsResult = vk::enumerateInstanceExtensionProperties();
+        VK_ASSERT(enumerateInstanceExtensionPropsResult);
+        s_extensions = enumerateInstanceExtensionPropsResult.value;
+
+        auto enumerateInstanceLayerPropsResult = vk::enumerateInstanceLayerProperties();
+        VK_ASSERT(enumerateInstanceLayerPropsResult);
+        s_layers = enumerateInstanceLayerPropsResult.value;
+
+        vk::ApplicationInfo appInfo = vk::ApplicationInfo();
+        appInfo.setPApplicationName("Mo Renderer");
+        appInfo.setApplicationVersion(VK_MAKE_VERSION(0, 0, 1));
+        appInfo.setPEngineName("MO");
+        appInfo.setEngineVersion(VK_MAKE_VERSION(0, 0, 1));
+        appInfo.setApiVersion(VK_API_VERSION_1_2);
+
+        vk::InstanceCreateInfo createInfo = vk::InstanceCreateInfo();
+        createInfo.setPApplicationInfo(&appInfo);
+
+        uint32_t glfwExtensionCount = 0;
+        const char** glfwExtensions;
+        glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+        for (int i = 0; i < glfwExtensionCount; i++)
+        {
+            instanceExtensions[glfwExtensions[i]] = glfwExtensions[i];
+        }
+        
+        std::vector<const char*> finalInstanceExtensions;
+        for (auto& pair : instanceExtensions)
+        {
+            finalInstanceExtensions.push_back(pair.second);
+        }
+
+        createInfo.setEnabledExtensionCount(finalInstanceExtensions.size());
+        createInfo.setPpEnabledExtensionNames(finalInstanceExtensions.data());
+
+        if (desc.debugMode)
+        {
+            s_expectedLayers.push_back("VK_LAYER_KHRONOS_validation");   
+        }
+
+        if (CheckLayerSupport(s_expectedLayers))
+        {
+            createInfo.setEnabledLayerCount(s_expectedLayers.size());
+            createInfo.setPpEnabledLayerNames(s_expectedLayers.data());
+        }
+        else
+        {
+            assert(false);
+            createInfo.setEnabledLayerCount(0);
+        }
+
+        auto createInstanceResult = vk::createInstance(createInfo);
+        VK_ASSERT(createInstanceResult);
+        s_instance  = createInstanceResult.value;
+
+        auto enumeratePhysicalDevicesResult = s_instance.enumeratePhysicalDevices();
+        VK_ASSERT(enumeratePhysicalDevicesResult);
+        s_physicalDevice = ChooseDevice(enumeratePhysicalDevicesResult.value);
+        s_physicalDeviceMemoryProperties = s_physicalDevice.getMemoryProperties();
+        s_physicalDeviceProperties = s_physicalDevice.getProperties();
+
+        // Create Surface
+        glfwCreateWindowSurface(s_instance, desc.window, nullptr, &s_surface);
+
+        /*
+        Create Queue Family
+        */
+        auto familyProperties = s_physicalDevice.getQueueFamilyProperties();
+        for (uint32_t i = 0; i < familyProperties.size(); i++)
+        {
+            auto familyProp = familyProperties[i];
+            if (familyProp.queueFlags & vk::QueueFlagBits::eGraphics)
+            {
+                s_graphicsFamily = i;
+            }
+
+            auto getSurfaceSupportKHRResult = s_physicalDevice.getSurfaceSupportKHR(i, s_surface);
+            VK_ASSERT(getSurfaceSupportKHRResult);
+            if (getSurfaceSupportKHRResult.value)
+            {
+                s_presentFamily = i;
+            }
+        }
+
+        // Transfer Only Family For Uploads, Software Implementations Usually Have None
+        s_transferFamily = s_graphicsFamily;
+        for (uint32_t i = 0; i < familyProperties.size(); i++)
+        {
+            auto queueFlags = familyProperties[i].queueFlags;
+            if ((queueFlags & vk::QueueFlagBits::eTransfer) && !(queueFlags & vk::QueueFlagBits::eGraphics) && !(queueFlags & vk::QueueFlagBits::eCompute))
+            {
+                s_transferFamily = i;
+                break;
+            }
+        }
+
+        /*
+        Create Logical Device
+        */
+
+        // One Queue Create Info Per Distinct Family
+        std::vector<uint32_t> queueFamilies = { s_graphicsFamily };
+        if (s_presentFamily != s_graphicsFamily)
+        {
+            queueFamilies.push_back(s_presentFamily);
+        }
+        if (s_transferFamily != s_graphicsFamily && s_transferFamily != s_presentFamily)
+        {
+            queueFamilies.push_back(s_transferFamily);
+        }
+
+        float queuePriority = 1.0f;
+        std::vector<vk::DeviceQueueCreateInfo> queueCreateInfos;
+        for (auto queueFamily : queueFamilies)
+        {
+            vk::DeviceQueueCreateInfo queueCreateInfo = {};
+            queueCreateInfo.setQueueFamilyIndex(queueFamily);
+            queueCreateInfo.setQueueCount(1);
+            queueCreateInfo.setPQueuePriorities(&queuePriority);
+            queueCreateInfos.push_back(queueCreateInfo);
+        }
+
+        // Features
+        vk::PhysicalDeviceFeatures deviceFeatures = s_physicalDevice.getFeatures();
+        s_multiDrawIndirectEnabled = deviceFeatures.multiDrawIndirect;
+
+        // Device Create Info
+        vk::DeviceCreateInfo deviceCreateInfo = {};
+        deviceCreateInfo.setQueueCreateInfoCount(queueCreateInfos.size());
+        deviceCreateInfo.setPQueueCreateInfos(queueCreateInfos.data());
+
+        for (auto& pair : deviceExtensions)
+        {
+            s_expectedExtensions.push_back(pair.second);
+        }
+
+        deviceCreateInfo.setEnabledExtensionCount(s_expectedExtensions.size());
+        deviceCreateInfo.setPpEnabledExtensionNames(s_expectedExtensions.data());
+        deviceCreateInfo.setPEnabledFeatures(&deviceFeatures);
+
+        // Vulkan 1.2 Features In One Struct, The Promoted Per Extension Feature Structs Must Not Be Chained Alongside It
+        auto supportedFeatures = s_physicalDevice.getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceVulkan12Features>();
+        const vk::PhysicalDeviceVulkan12Features& supportedVulkan12Features = supportedFeatures.get<vk::PhysicalDeviceVulkan12Features>();
+
+        vk::PhysicalDeviceVulkan12Features vulkan12Features = {};
+        if (s_bufferDeviceAddressEnabled)
+        {
+            vulkan12Features.setBufferDeviceAddress(true);
+        }
+
+        if (s_bindlessEnabled)
+        {
+            // Requesting A Missing Feature Fails Device Creation, Turn Bindless Off Instead
+            struct RequiredFeature
+            {
+                vk::Bool32 supported;
+                const char* name;
+            };
+
+            RequiredFeature bindlessFeatures[] =
+            {
+                { supportedVulkan12Features.shaderSampledImageArrayNonUniformIndexing, "shaderSampledImageArrayNonUniformIndexing" },
+                { supportedVulkan12Features.runtimeDescriptorArray, "runtimeDescriptorArray" },
+                { supportedVulkan12Features.descriptorBindingPartiallyBound, "descriptorBindingPartiallyBound" },
+                { supportedVulkan12Features.descriptorBindingSampledImageUpdateAfterBind, "descriptorBindingSampledImageUpdateAfterBind" },
+                { supportedVulkan12Features.descriptorBindingUpdateUnusedWhilePending, "descriptorBindingUpdateUnusedWhilePending" },
+            };
+
+            for (const auto& feature : bindlessFeatures)
+            {
+                if (!feature.supported)
+                {
+                    printf("GFX: Extension::Bindless disabled, the device does not support %s \n", feature.name);
+                    s_bindlessEnabled = false;
+                    break;
+                }
+            }
+        }
+
+        if (s_bindlessEnabled)
+        {
+            vulkan12Features.setShaderSampledImageArrayNonUniformIndexing(true);
+            vulkan12Features.setRuntimeDescriptorArray(true);
+            vulkan12Features.setDescriptorBindingPartiallyBound(true);
+            vulkan12Features.setDescriptorBindingSampledImageUpdateAfterBind(true);
+            vulkan12Features.setDescriptorBindingUpdateUnusedWhilePending(true);
+        }
+
+        s_drawIndirectCountEnabled = supportedVulkan12Features.drawIndirectCount;
+        vulkan12Features.setDrawIndirectCount(s_drawIndirectCountEnabled);
+
+        deviceCreateInfo.setPNext(&vulkan12Features);
+
+        auto allDeviceExtensions = s_physicalDevice.enumerateDeviceExtensionProperties();
+
+        auto createDeviceResult = s_physicalDevice.createDevice(deviceCreateInfo);
+        VK_ASSERT(createDeviceResult);
+        s_device = createDeviceResult.value;
+
+        // Create Default Queue
+        s_graphicsQueueDefault = s_device.getQueue(s_graphicsFamily, 0);
+        s_presentQueueDefault = s_device.getQueue(s_presentFamily, 0);
+        s_transferQueueDefault = s_device.getQueue(s_transferFamily, 0);
+
+        CreateMemoryPools();
+
+        CreateSwapChain();
+        CreateImageViews();
+     
+        CreateCommandPoolDefault();
+        CreateUploadResources();
+        CreateTransientUniformResources();
+
+        ktxVulkanDeviceInfo_Construct(&s_ktx_device_info, s_physicalDevice, s_device, s_graphicsQueueDefault, s_commandPoolDefault, nullptr);
+
+        CreateCommandBuffersDefault();
+        CreateSyncObjects();
+        CreateDescriptorAllocators();
+
+        if (s_bindlessEnabled)
+        {
+            CreateBindlessResources();
+        }
+
+        for (auto extension : desc.extensions)
+        {
+            if (extension == GFX::Extension::Raytracing)
+            {
+                auto props = s_physicalDevice.getProperties2<vk::PhysicalDeviceProperties2, vk::PhysicalDeviceRayTracingPropertiesKHR>();
+                s_rayTracingProperties = props.get<vk::PhysicalDeviceRayTracingPropertiesKHR>();
+            }
+        }
+    }
+
+    void Resize(int width, int height)
+    {
+        RecreateSwapChain();
+    }
+
+    // resize all attachments
+    void ResizeRenderPass(RenderPass renderPass, int width, int height)
+    {
+        RenderPassResource* renderPassResource = s_renderPassHandlePool.FetchResource(renderPass.id);
+        renderPassResource->Resize(width, height);
+
+        // Bundles Drawing Into The Pass Or Binding Refreshed Uniforms Record Again On Their Next Execute
+        for (auto bundleHandle : s_renderBundles)
+        {
+            RenderBundleResource* bundle = s_renderBundleHandlePool.FetchResource(bundleHandle);
+
+            bool affected = bundle->m_renderPass.id == renderPass.id;
+            for (auto uniformHandle : renderPassResource->m_dependentUniforms)
+            {
+                affected = affected || std::binary_search(bundle->m_uniforms.begin(), bundle->m_uniforms.end(), uniformHandle);
+            }
+
+            if (affected)
+            {
+                bundle->ReleaseCommandBuffers();
+            }
+        }
+    }
+
+    bool BeginFrame()
+    {
+        s_device.waitForFences(1, &s_inFlightFences[s_currentFrame], false, UINT64_MAX);
+
+        // The Fence Stays Signaled Until EndFrame Submits Again, So A Failed Acquire Can Not Dead Lock The Next BeginFrame
+        ProcessDeferredDeletions();
+        RetireUploads();
+
+        // The GPU Is Done With This Frame's Transient Uniform Region
+        s_transientUniformHead = s_currentFrame * TRANSIENT_UNIFORM_REGION_SIZE;
+        ResetTransientDescriptorPools(s_currentFrame);
+        ResetThreadCommandPools(s_currentFrame);
+
+        // The Frame That Used This Slot Has Consumed Its Upload Semaphore
+        if (s_frameUploadSemaphores[s_currentFrame])
+        {
+            s_freeUploadSemaphores.push_back(s_frameUploadSemaphores[s_currentFrame]);
+            s_frameUploadSemaphores[s_currentFrame] = nullptr;
+        }
+
+        auto acquireNextImageResult = s_device.acquireNextImageKHR(s_swapChain, UINT64_MAX, s_imageAvailableSemaphores[s_currentFrame], nullptr);
+        
+        if (acquireNextImageResult.result == vk::Result::eErrorOutOfDateKHR || acquireNextImageResult.result == vk::Result::eSuboptimalKHR)
+        {
+            printf("Inline Resize \n");
+            RecreateSwapChain();
+            return false;
+        }
+        else
+        {
+            VK_ASSERT(acquireNextImageResult);
+        }
+
+        s_currentImageIndex = acquireNextImageResult.value;
+
+        vk::CommandBufferBeginInfo commandBufferBeginInfo = {};
+        commandBufferBeginInfo.setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit);
+
+        auto commandBufferBeginResult = s_commandBuffersDefault[s_currentImageIndex].begin(commandBufferBeginInfo);
+        assert(commandBufferBeginResult == vk::Result::eSuccess);
+
+        s_frameContext = CommandContext();
+        s_frameContext.commandBuffer = s_commandBuffersDefault[s_currentImageIndex];
+
+        s_frameRecording = true;
+        return true;
+    }
+
+    /*void BeginDefaultRenderPass()
+    {
+        vk::RenderPassBeginInfo renderPassBeginInfo = {};
+        
+        renderPassBeginInfo.setRenderPass(s_renderPassDefault);
+        renderPassBeginInfo.setFramebuffer(s_swapChainFrameBuffers[s_currentImageIndex]);
+        
+        vk::Rect2D area = {};
+        area.setExtent(s_swapChainImageExtent);
+        area.setOffset({ 0, 0 });
+        renderPassBeginInfo.setRenderArea(area);
+
+        vk::ClearColorValue colorValue = {};
+        colorValue.setFloat32({ 0.0f, 0.0f, 0.0f, 1.0f });
+        vk::ClearValue clearColor = {};
+        clearColor.setColor(colorValue);
+
+        vk::ClearValue clearDepthStencil = {};
+        clearDepthStencil.setDepthStencil({ 1.0f, 0 });
+
+        std::vector<vk::ClearValue> clearValues = { clearColor, clearDepthStencil };
+
+        renderPassBeginInfo.setClearValueCount(clearValues.size());
+        renderPassBeginInfo.setPClearValues(clearValues.data());
+        
+        s_commandBuffersDefault[s_currentImageIndex].beginRenderPass(renderPassBeginInfo, vk::SubpassContents::eInline);
+    }*/
+
+    void BeginRenderPass(RenderPass renderPass, int offsetX, int offsetY, int width, int height, SubpassContents contents)
+    {
+        auto renderPassResource = s_renderPassHandlePool.FetchResource(renderPass.id);
+        
+        vk::RenderPassBeginInfo renderPassBeginInfo = {};
+
+        renderPassBeginInfo.setRenderPass(renderPassResource->m_renderPass);
+        renderPassBeginInfo.setFramebuffer(renderPassResource->m_framebuffers[s_currentImageIndex]);
+        renderPassBeginInfo.setClearValueCount(renderPassResource->m_clearValues.size());
+        renderPassBeginInfo.setPClearValues(renderPassResource->m_clearValues.data());
+
+        vk::Rect2D rect = {};
+        rect.setOffset({ offsetX, offsetY });
+        rect.setExtent({ (uint32_t)width, (uint32_t)height });
+        renderPassBeginInfo.setRenderArea(rect);
+
+        s_commandBuffersDefault[s_currentImageIndex].beginRenderPass(renderPassBeginInfo, MapSubpassContentsForVulkan(contents));
+        s_insideRenderPass = true;
+    }
+
+    void NextSubpass(SubpassContents contents)
+    {
+        s_commandBuffersDefault[s_currentImageIndex].nextSubpass(MapSubpassContentsForVulkan(contents));
+    }
+
+    void EndRenderPass()
+    {
+        s_commandBuffersDefault[s_currentImageIndex].endRenderPass();
+        s_insideRenderPass = false;
+    }
+
+    void EndFrame()
+    {
+        // Work Recorded By An Open Upload Batch Must Reach The Queue Before The Frame Reading It
+        SubmitUploads();
+
+        s_commandBuffersDefault[s_currentImageIndex].end();
+        s_frameRecording = false;
+
+        s_lastFrameRenderStatistics = s_frameContext.statistics;
+
+        /*
+        Submit Commands
+        */
+        vk::SubmitInfo submitInfo = {};
+        
+        std::vector<vk::Semaphore> waitSemaphores = { s_imageAvailableSemaphores[s_currentFrame] };
+        std::vector<vk::PipelineStageFlags> waitStages = { vk::PipelineStageFlagBits::eColorAttachmentOutput };
+        std::vector<vk::CommandBuffer> commandBuffers;
+
+        // Acquire Resources Released By The Transfer Queue Before The Frame Reads Them
+        if (!s_pendingAcquireBufferBarriers.empty() || !s_pendingAcquireImageBarriers.empty())
+        {
+            auto acquireCommandBuffer = s_acquireCommandBuffers[s_currentFrame];
+
+            vk::CommandBufferBeginInfo beginInfo = {};
+            beginInfo.setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit);
+            acquireCommandBuffer.begin(beginInfo);
+            RecordPendingAcquires(acquireCommandBuffer);
+            acquireCommandBuffer.end();
+
+            commandBuffers.push_back(acquireCommandBuffer);
+        }
+
+        if (s_pendingUploadSemaphore)
+        {
+            waitSemaphores.push_back(s_pendingUploadSemaphore);
+            waitStages.push_back(vk::PipelineStageFlagBits::eAllCommands);
+            s_frameUploadSemaphores[s_currentFrame] = s_pendingUploadSemaphore;
+            s_pendingUploadSemaphore = nullptr;
+        }
+
+        commandBuffers.push_back(s_commandBuffersDefault[s_currentImageIndex]);
+
+        submitInfo.setWaitSemaphoreCount(waitSemaphores.size());
+        submitInfo.setPWaitSemaphores(waitSemaphores.data());
+        submitInfo.setPWaitDstStageMask(waitStages.data());
+        submitInfo.setCommandBufferCount(commandBuffers.size());
+        submitInfo.setPCommandBuffers(commandBuffers.data());
+        submitInfo.setSignalSemaphoreCount(1);
+        submitInfo.setPSignalSemaphores(&s_renderFinishedSemaphores[s_currentFrame]);
+
+        s_device.resetFences(s_inFlightFences[s_currentFrame]);
+        auto submitResult = s_graphicsQueueDefault.submit(submitInfo, s_inFlightFences[s_currentFrame]);
+        assert(submitResult == vk::Result::eSuccess);
+
+        vk::PresentInfoKHR presentInfo = {};
+        presentInfo.setWaitSemaphoreCount(1);
+        presentInfo.setPWaitSemaphores(&s_renderFinishedSemaphores[s_currentFrame]);
+        presentInfo.setPSwapchains(&s_swapChain);
+        presentInfo.setPImageIndices(&s_currentImageIndex);
+        presentInfo.setSwapchainCount(1);
+
+        auto presentResult = s_presentQueueDefault.presentKHR(presentInfo);
+        if (presentResult == vk::Result::eErrorOutOfDateKHR || presentResult == vk::Result::eSuboptimalKHR)
+        {
+            printf("Inline Resize \n");
+            RecreateSwapChain();
+        }
+        else
+        {
+            assert(presentResult == vk::Result::eSuccess);
+        }
+
+        s_currentFrame = (s_currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+        s_frameCount++;
+    }
+
+    void FlushDeletions()
+    {
+        // Resources About To Be Destroyed May Still Wait For Their Acquire Barriers
+        SubmitUploads();
+        SubmitPendingAcquires();
+
+        s_device.waitIdle();
+
+        while (!s_deferredDeletions.empty())
+        {
+            s_deferredDeletions.front().destroy();
+            s_deferredDeletions.pop_front();
+        }
+    }
+
+    void Shutdown()
+    {
+        FlushDeletions();
+
+        ktxVulkanDeviceInfo_Destruct(&s_ktx_device_info);
+
+        DestroyDescriptorAllocators();
+        DestroyThreadCommandPools();
+        DestroyRenderBundleResources();
+
+        if (s_bindlessEnabled)
+        {
+            DestroyBindlessResources();
+        }
+
+        for (auto fence : s_inFlightFences)
+        {
+            s_device.destroyFence(fence);
+        }
+
+        for (auto semaphore : s_imageAvailableSemaphores)
+        {
+            s_device.destroySemaphore(semaphore);
+        }
+
+        for (auto semaphore : s_renderFinishedSemaphores)
+        {
+            s_device.destroySemaphore(semaphore);
+        }
+
+        s_device.destroyCommandPool(s_commandPoolDefault);
+
+        for (auto imageView : s_swapChainImageViews)
+        {
+            vkDestroyImageView(s_device, imageView, nullptr);
+        }
+
+        vkDestroySwapchainKHR(s_device, s_swapChain, nullptr);
+        vkDestroySurfaceKHR(s_instance, s_surface, nullptr);
+
+        DestroyTransientUniformResources();
+        DestroyUploadResources();
+        DestroyMemoryPools();
+
+        s_device.destroy();
+        s_instance.destroy();
+    }
+
+    void CreateImageViews()
+    {
+        for (size_t i = 0; i < s_swapChainImages.size(); i++)
+        {
+            s_swapChainImageViews.push_back(CreateVulkanImageView(s_swapChainImages[i], s_swapChainImageFormat, vk::ImageAspectFlagBits::eColor, vk::ImageViewType::e2D, 1, 1));
+        }
+    }
+
+    void CreateSwapChain()
+    {
+        // Query Swap Chain Info
+        auto getSurfaceCapabilityiesResult = s_physicalDevice.getSurfaceCapabilitiesKHR(s_surface);
+        VK_ASSERT(getSurfaceCapabilityiesResult);
+        s_swapChainSupportDetails.capabilities = getSurfaceCapabilityiesResult.value;
+        auto getSurfaceFormatsResult = s_physicalDevice.getSurfaceFormatsKHR(s_surface);
+        VK_ASSERT(getSurfaceFormatsResult);
+        s_swapChainSupportDetails.formats = getSurfaceFormatsResult.value;
+        auto getSurfacePresentModesResult = s_physicalDevice.getSurfacePresentModesKHR(s_surface);
+        VK_ASSERT(getSurfacePresentModesResult);
+        s_swapChainSupportDetails.presentModes = getSurfacePresentModesResult.value;
+        assert(s_swapChainSupportDetails.IsAdequate());
+
+        vk::SurfaceFormatKHR surfaceFormat = ChooseSurfaceFormat(s_swapChainSupportDetails.formats);
+        vk::PresentModeKHR presentMode = ChoosePresentMode(s_swapChainSupportDetails.presentModes);
+        vk::Extent2D extent = ChooseSwapExtent(s_swapChainSupportDetails.capabilities);
+
+        uint32_t imageCount = s_swapChainSupportDetails.capabilities.minImageCount + 1;
+        if (s_swapChainSupportDetails.capabilities.maxImageCount > 0 && imageCount > s_swapChainSupportDetails.capabilities.maxImageCount)
+        {
+            imageCount = s_swapChainSupportDetails.capabilities.maxImageCount;
+        }
+
+        vk::SwapchainCreateInfoKHR createInfo = {};
+        createInfo.setSurface(s_surface);
+        createInfo.setMinImageCount(imageCount);
+        createInfo.setImageFormat(surfaceFormat.format);
+        createInfo.setImageColorSpace(surfaceFormat.colorSpace);
+        createInfo.setImageExtent(extent);
+        createInfo.setImageArrayLayers(1);
+        createInfo.setImageUsage(vk::ImageUsageFlagBits::eColorAttachment);
+
+        uint32_t queueFamilyIndices[] = { s_graphicsFamily, s_presentFamily };
+
+        if (s_graphicsFamily != s_presentFamily)
+        {
+            createInfo.setImageSharingMode(vk::SharingMode::eConcurrent);
+            createInfo.setQueueFamilyIndexCount(2);
+            createInfo.setPQueueFamilyIndices(queueFamilyIndices);
+        }
+        else
+        {
+            createInfo.setImageSharingMode(vk::SharingMode::eExclusive);
+        }
+
+        createInfo.setPreTransform(s_swapChainSupportDetails.capabilities.currentTransform);
+        createInfo.setCompositeAlpha(vk::CompositeAlphaFlagBitsKHR::eOpaque);
+        createInfo.setPresentMode(presentMode);
+        createInfo.setClipped(true);
+        createInfo.setOldSwapchain(nullptr);
+
+        auto createSwapChainResult = s_device.createSwapchainKHR(createInfo);
+        VK_ASSERT(createSwapChainResult);
+        s_swapChain = createSwapChainResult.value;
+
+        vkGetSwapchainImagesKHR(s_device, s_swapChain, &imageCount, nullptr);
+        s_swapChainImages.resize(imageCount);
+        vkGetSwapchainImagesKHR(s_device, s_swapChain, &imageCount, s_swapChainImages.data());
+
+        s_swapChainImageFormat = surfaceFormat.format;
+        s_swapChainImageExtent = extent;
+    }
+
+    void RecreateSwapChain()
     {
         s_device.waitIdle();
 
-        ktxVulkanDeviceInfo_Destruct(&s_ktx_device_info);
+        /*for (auto framebuffer : s_swapChainFrameBuffers)
+        {
+            vkDestroyFramebuffer(s_device, framebuffer, nullptr);
+        }*/
+
+        for (auto imageView : s_swapChainImageViews)
+        {
+            vkDestroyImageView(s_device, imageView, nullptr);
+        }
+
+        vkDestroySwapchainKHR(s_device, s_swapChain, nullptr);
+
+        // s_swapChainFrameBuffers.clear();
+        s_swapChainImageViews.clear();
+        s_swapChainImages.clear();
+
+        // s_device.destroyImageView(s_depthImageView);
+       /* s_device.destroyImage(s_depthImage);
+        s_device.freeMemory(s_depthImageMemory);*/
+
+        CreateSwapChain();
+        CreateImageViews();
+        // CreateDepthImage();
+        // CreateSwapChainFramebuffers();
+    }
+
+  /*  void CreateSwapChainFramebuffers()
+    {
+        s_swapChainFrameBuffers.resize(s_swapChainImageViews.size());
+        for (size_t i = 0; i < s_swapChainImageViews.size(); i++)
+        {
+            std::vector<VkImageView> attachments = { s_swapChainImageViews[i], s_depthImageView };
+
+            VkFramebufferCreateInfo framebufferInfo = {};
+            framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+            framebufferInfo.renderPass = s_renderPassDefault;
+            framebufferInfo.attachmentCount = attachments.size();
+            framebufferInfo.pAttachments = attachments.data();
+            framebufferInfo.width = s_swapChainImageExtent.width;
+            framebufferInfo.height = s_swapChainImageExtent.height;
+            framebufferInfo.layers = 1;
+
+            auto result = vkCreateFramebuffer(s_device, &framebufferInfo, nullptr, &s_swapChainFrameBuffers[i]);
+            assert(result == VK_SUCCESS);
+        }
+    }*/
+
+    void CreateCommandPoolDefault()
+    {
+        vk::CommandPoolCreateInfo commandPoolCreateInfo = {};
+        commandPoolCreateInfo.setQueueFamilyIndex(s_graphicsFamily);
+        commandPoolCreateInfo.setFlags(vk::CommandPoolCreateFlagBits::eResetCommandBuffer);
+        auto createCommandPoolResult = s_device.createCommandPool(commandPoolCreateInfo);
+        VK_ASSERT(createCommandPoolResult);
+
+        s_commandPoolDefault = createCommandPoolResult.value;
+    }
+
+    void CreateCommandBuffersDefault()
+    {
+        vk::CommandBufferAllocateInfo commandBufferAllocateInfo = {};
+        commandBufferAllocateInfo.setCommandBufferCount(s_swapChainImages.size());
+        commandBufferAllocateInfo.setCommandPool(s_commandPoolDefault);
+        commandBufferAllocateInfo.setLevel(vk::CommandBufferLevel::ePrimary);
+
+        auto allocateCommandBuffersResult = s_device.allocateCommandBuffers(commandBufferAllocateInfo);
+        VK_ASSERT(allocateCommandBuffersResult);
+        s_commandBuffersDefault = allocateCommandBuffersResult.value;
+    }
+
+    void CreateDescriptorAllocators()
+    {
+        s_persistentDescriptorPools.freeable = true;
+        s_persistentDescriptorPools.pools.push_back(CreateDescriptorPool(s_persistentDescriptorPools, {}, 0));
+
+        for (uint32_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
+        {
+            s_transientDescriptorPools[i].freeable = false;
+            s_transientDescriptorPools[i].pools.push_back(CreateDescriptorPool(s_transientDescriptorPools[i], {}, 0));
+        }
+    }
 
-        s_device.destroyDescriptorPool(s_descriptorPoolDefault);
+    void DestroyDescriptorAllocators()
+    {
+        for (uint32_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
+        {
+            ResetTransientDescriptorPools(i);
 
-        for (auto fence : s_inFlightFences)
+            for (auto pool : s_transientDescriptorPools[i].pools)
+            {
+                s_device.destroyDescriptorPool(pool);
+            }
+            s_transientDescriptorPools[i] = DescriptorPoolChain();
+        }
+
+        for (auto pool : s_persistentDescriptorPools.pools)
         {
-            s_device.destroyFence(fence);
+            s_device.destroyDescriptorPool(pool);
         }
+        s_persistentDescriptorPools = DescriptorPoolChain();
+    }
 
-        for (auto semaphore : s_imageAvailableSemaphores)
+    void ResetTransientDescriptorPools(uint32_t frame)
+    {
+        for (auto handle : s_transientUniforms[frame])
         {
-            s_device.destroySemaphore(semaphore);
+            s_uniformHandlePool.FreeHandle(handle);
         }
+        s_transientUniforms[frame].clear();
 
-        for (auto semaphore : s_renderFinishedSemaphores)
+        DescriptorPoolChain& chain = s_transientDescriptorPools[frame];
+        for (auto pool : chain.pools)
+        {
+            s_device.resetDescriptorPool(pool);
+        }
+
+        // Keep The Peaks So A Frame That Needed Several Pools Is Served By The Same Pools Next Time
+        chain.current = 0;
+        chain.usage.clear();
+        chain.setCount = 0;
+    }
+
+    vk::DescriptorPool CreateDescriptorPool(const DescriptorPoolChain& chain, const std::map<vk::DescriptorType, uint32_t>& request, uint32_t requestSetCount)
+    {
+        // Baseline Capacity Of The First Pool, Later Pools Grow To The Observed Peak
+        std::map<vk::DescriptorType, uint32_t> capacity;
+        capacity[vk::DescriptorType::eUniformBuffer] = 512;
+        capacity[vk::DescriptorType::eUniformBufferDynamic] = 128;
+        capacity[vk::DescriptorType::eStorageBuffer] = 128;
+        capacity[vk::DescriptorType::eStorageImage] = 64;
+        capacity[vk::DescriptorType::eSampledImage] = 256;
+        capacity[vk::DescriptorType::eInputAttachment] = 32;
+        capacity[vk::DescriptorType::eCombinedImageSampler] = 256;
+
+        for (auto& peak : chain.peakUsage)
+        {
+            capacity[peak.first] = std::max(capacity[peak.first], peak.second);
+        }
+
+        for (auto& requested : request)
+        {
+            capacity[requested.first] = std::max(capacity[requested.first], requested.second);
+        }
+
+        std::vector<vk::DescriptorPoolSize> sizes;
+        for (auto& entry : capacity)
+        {
+            vk::DescriptorPoolSize poolSize = {};
+            poolSize.setType(entry.first);
+            poolSize.setDescriptorCount(entry.second);
+
+            sizes.push_back(poolSize);
+        }
+
+        uint32_t maxSets = std::max(DESCRIPTOR_POOL_MIN_SETS, std::max(chain.peakSetCount, requestSetCount));
+
+        vk::DescriptorPoolCreateInfo poolCreateInfo = {};
+        poolCreateInfo.setPoolSizeCount(sizes.size());
+        poolCreateInfo.setPPoolSizes(sizes.data());
+        poolCreateInfo.setMaxSets(maxSets);
+        if (chain.freeable)
+        {
+            poolCreateInfo.setFlags(vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet);
+        }
+
+        auto createDescriptorPoolResult = s_device.createDescriptorPool(poolCreateInfo);
+        VK_ASSERT(createDescriptorPoolResult);
+        return createDescriptorPoolResult.value;
+    }
+
+    vk::DescriptorPool AllocateDescriptorSets(DescriptorPoolChain& chain, UniformLayoutResource* layout, uint32_t setCount, std::vector<vk::DescriptorSet>& descriptorSets)
+    {
+        std::vector<vk::DescriptorSetLayout> layouts(setCount, layout->m_descriptorSetLayout);
+
+        vk::DescriptorSetAllocateInfo descriptorSetAllocateInfo = {};
+        descriptorSetAllocateInfo.setDescriptorSetCount(setCount);
+        descriptorSetAllocateInfo.setPSetLayouts(layouts.data());
+
+        chain.setCount += setCount;
+        chain.peakSetCount = std::max(chain.peakSetCount, chain.setCount);
+
+        std::map<vk::DescriptorType, uint32_t> request;
+        for (auto& entry : layout->m_descriptorCounts)
+        {
+            request[entry.first] = entry.second * setCount;
+
+            uint32_t& usage = chain.usage[entry.first];
+            usage += entry.second * setCount;
+            chain.peakUsage[entry.first] = std::max(chain.peakUsage[entry.first], usage);
+        }
+
+        // Start From The Pool That Served Last, Freed Sets May Have Opened Room In Earlier Ones
+        for (size_t i = 0; i < chain.pools.size(); i++)
+        {
+            size_t poolIndex = (chain.current + i) % chain.pools.size();
+            descriptorSetAllocateInfo.setDescriptorPool(chain.pools[poolIndex]);
+
+            auto allocateDescriptorSetsResult = s_device.allocateDescriptorSets(descriptorSetAllocateInfo);
+            if (allocateDescriptorSetsResult.result == vk::Result::eSuccess)
+            {
+                chain.current = poolIndex;
+                descriptorSets = allocateDescriptorSetsResult.value;
+                return chain.pools[poolIndex];
+            }
+
+            if (allocateDescriptorSetsResult.result != vk::Result::eErrorOutOfPoolMemory && allocateDescriptorSetsResult.result != vk::Result::eErrorFragmentedPool)
+            {
+                VK_ASSERT(allocateDescriptorSetsResult);
+            }
+        }
+
+        // Every Pool Is Exhausted, Chain A New One Large Enough For The Whole Observed Demand
+        vk::DescriptorPool pool = CreateDescriptorPool(chain, request, setCount);
+        chain.pools.push_back(pool);
+        chain.current = chain.pools.size() - 1;
+
+        descriptorSetAllocateInfo.setDescriptorPool(pool);
+        auto allocateDescriptorSetsResult = s_device.allocateDescriptorSets(descriptorSetAllocateInfo);
+        VK_ASSERT(allocateDescriptorSetsResult);
+        descriptorSets = allocateDescriptorSetsResult.value;
+
+        return pool;
+    }
+
+    void ReleaseDescriptorSets(DescriptorPoolChain& chain, const std::map<vk::DescriptorType, uint32_t>& descriptorCounts, uint32_t setCount)
+    {
+        chain.setCount -= setCount;
+        for (auto& entry : descriptorCounts)
+        {
+            chain.usage[entry.first] -= entry.second * setCount;
+        }
+    }
+
+    void CreateSyncObjects()
+    {        
+        s_imageAvailableSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
+        s_renderFinishedSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
+        s_inFlightFences.resize(MAX_FRAMES_IN_FLIGHT);
+
+        vk::SemaphoreCreateInfo semaphoreCreateInfo = {};
+        vk::FenceCreateInfo fenceCreateInfo = {};
+        fenceCreateInfo.setFlags(vk::FenceCreateFlagBits::eSignaled);
+
+        for (int i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
+        {
+            auto imageAvailableSemaphoreCreateResult = s_device.createSemaphore(semaphoreCreateInfo);
+            VK_ASSERT(imageAvailableSemaphoreCreateResult);
+            s_imageAvailableSemaphores[i] = imageAvailableSemaphoreCreateResult.value;
+
+            auto renderFinishedSemaphoreCreateResult = s_device.createSemaphore(semaphoreCreateInfo);
+            VK_ASSERT(renderFinishedSemaphoreCreateResult);
+            s_renderFinishedSemaphores[i] = renderFinishedSemaphoreCreateResult.value;
+
+            auto createInFlightFenceResult = s_device.createFence(fenceCreateInfo);
+            VK_ASSERT(createInFlightFenceResult);
+            s_inFlightFences[i] = createInFlightFenceResult.value;
+        }
+    }
+
+    void DeferDeletion(std::function<void()> destroy)
+    {
+        DeferredDeletion deletion = {};
+        deletion.frame = s_frameCount;
+        deletion.destroy = destroy;
+
+        s_deferredDeletions.push_back(deletion);
+    }
+
+    void RefreshUniformAttachments(uint32_t uniformHandle, uint32_t renderPassHandle)
+    {
+        s_uniformHandlePool.FetchResource(uniformHandle)->RefreshAttachmentDescriptors(renderPassHandle);
+    }
+
+    void ProcessDeferredDeletions()
+    {
+        // Called After Waiting The Current In Flight Fence, Every Frame Older Than MAX_FRAMES_IN_FLIGHT Has Completed
+        while (!s_deferredDeletions.empty() && s_deferredDeletions.front().frame + MAX_FRAMES_IN_FLIGHT <= s_frameCount)
+        {
+            s_deferredDeletions.front().destroy();
+            s_deferredDeletions.pop_front();
+        }
+    }
+
+    void CreateUploadResources()
+    {
+        std::vector<uint32_t> families = { s_transferFamily, s_graphicsFamily };
+        for (uint32_t i = 0; i < 2; i++)
+        {
+            // Without A Transfer Family Everything Goes Through The Graphics Pool
+            if (i == static_cast<uint32_t>(UploadQueue::Transfer) && s_transferFamily == s_graphicsFamily)
+            {
+                continue;
+            }
+
+            vk::CommandPoolCreateInfo commandPoolCreateInfo = {};
+            commandPoolCreateInfo.setQueueFamilyIndex(families[i]);
+            commandPoolCreateInfo.setFlags(vk::CommandPoolCreateFlagBits::eResetCommandBuffer | vk::CommandPoolCreateFlagBits::eTransient);
+            auto createCommandPoolResult = s_device.createCommandPool(commandPoolCreateInfo);
+            VK_ASSERT(createCommandPoolResult);
+            s_uploadCommandPools[i] = createCommandPoolResult.value;
+        }
+
+        vk::CommandBufferAllocateInfo commandBufferAllocateInfo = {};
+        commandBufferAllocateInfo.setCommandBufferCount(MAX_FRAMES_IN_FLIGHT);
+        commandBufferAllocateInfo.setCommandPool(s_commandPoolDefault);
+        commandBufferAllocateInfo.setLevel(vk::CommandBufferLevel::ePrimary);
+
+        auto allocateCommandBuffersResult = s_device.allocateCommandBuffers(commandBufferAllocateInfo);
+        VK_ASSERT(allocateCommandBuffersResult);
+        s_acquireCommandBuffers = allocateCommandBuffersResult.value;
+
+        s_frameUploadSemaphores.resize(MAX_FRAMES_IN_FLIGHT, nullptr);
+
+        CreateVulkanBuffer(
+            STAGING_RING_SIZE,
+            vk::BufferUsageFlagBits::eTransferSrc,
+            vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent,
+            MemoryPool::Staging,
+            s_stagingRingBuffer,
+            s_stagingRingAllocation);
+
+        void* mappedData = nullptr;
+        VkResult mapResult = vmaMapMemory(s_allocator, s_stagingRingAllocation, &mappedData);
+        assert(mapResult == VK_SUCCESS);
+        s_stagingRingMappedPtr = static_cast<uint8_t*>(mappedData);
+    }
+
+    void DestroyUploadResources()
+    {
+        SubmitUploads();
+        while (!s_pendingUploads.empty())
+        {
+            WaitOldestUpload();
+        }
+
+        for (uint32_t i = 0; i < 2; i++)
+        {
+            for (auto& upload : s_freeUploads[i])
+            {
+                s_device.destroyFence(upload.fence);
+            }
+            s_freeUploads[i].clear();
+
+            if (s_uploadCommandPools[i])
+            {
+                s_device.destroyCommandPool(s_uploadCommandPools[i]);
+                s_uploadCommandPools[i] = nullptr;
+            }
+        }
+
+        // Freed Together With s_commandPoolDefault, Which Shutdown Destroys First
+        s_acquireCommandBuffers.clear();
+
+        if (s_pendingUploadSemaphore)
+        {
+            s_freeUploadSemaphores.push_back(s_pendingUploadSemaphore);
+            s_pendingUploadSemaphore = nullptr;
+        }
+
+        for (auto semaphore : s_frameUploadSemaphores)
+        {
+            if (semaphore)
+            {
+                s_freeUploadSemaphores.push_back(semaphore);
+            }
+        }
+        s_frameUploadSemaphores.clear();
+
+        for (auto semaphore : s_freeUploadSemaphores)
         {
             s_device.destroySemaphore(semaphore);
         }
+        s_freeUploadSemaphores.clear();
 
-        s_device.destroyCommandPool(s_commandPoolDefault);
+        s_pendingAcquireBufferBarriers.clear();
+        s_pendingAcquireImageBarriers.clear();
 
-        for (auto imageView : s_swapChainImageViews)
+        vmaUnmapMemory(s_allocator, s_stagingRingAllocation);
+        DestroyVulkanBuffer(s_stagingRingBuffer, s_stagingRingAllocation);
+        s_stagingRingMappedPtr = nullptr;
+    }
+
+    UploadQueue ChooseUploadQueue(bool graphicsOwned)
+    {
+        // Re-uploads Would Need A Round Trip Ownership Transfer, Keep Them On The Graphics Queue
+        if (s_transferFamily != s_graphicsFamily && !graphicsOwned)
         {
-            vkDestroyImageView(s_device, imageView, nullptr);
+            return UploadQueue::Transfer;
         }
 
-        vkDestroySwapchainKHR(s_device, s_swapChain, nullptr);
-        vkDestroySurfaceKHR(s_instance, s_surface, nullptr);
-        s_device.destroy();
-        s_instance.destroy();
+        return UploadQueue::Graphics;
     }
 
-    void CreateImageViews()
+    StagingRegion AllocateStaging(vk::DeviceSize size, vk::DeviceSize alignment, UploadQueue queue)
     {
-        for (size_t i = 0; i < s_swapChainImages.size(); i++)
+        StagingRegion result = {};
+
+        // Switching Queues Submits The Recorded Uploads, Do It Now So Their ringEnd Stops Before This Region
+        if (s_currentUpload.commandBuffer && s_currentUpload.queue != queue)
         {
-            s_swapChainImageViews.push_back(CreateVulkanImageView(s_swapChainImages[i], s_swapChainImageFormat, vk::ImageAspectFlagBits::eColor, vk::ImageViewType::e2D, 1, 1));
+            SubmitUploads();
+        }
+
+        if (size > STAGING_RING_SIZE)
+        {
+            // Oversized, Give It A Dedicated Buffer Released Together With The Submission
+            GetUploadCommandBuffer(queue);
+
+            VmaAllocation allocation = nullptr;
+            CreateVulkanBuffer(size, vk::BufferUsageFlagBits::eTransferSrc, vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent, MemoryPool::Staging, result.buffer, allocation);
+
+            VkResult mapResult = vmaMapMemory(s_allocator, allocation, &result.mappedPtr);
+            assert(mapResult == VK_SUCCESS);
+
+            s_currentUpload.oversizedBuffers.push_back(result.buffer);
+            s_currentUpload.oversizedAllocations.push_back(allocation);
+            return result;
+        }
+
+        while (true)
+        {
+            RetireUploads();
+
+            // Ring Empty, Restart From The Beginning
+            if (s_stagingRingHead == s_stagingRingTail && s_pendingUploads.empty())
+            {
+                s_stagingRingHead = 0;
+                s_stagingRingTail = 0;
+            }
+
+            // Align The Ring Position, Not The Counter, The Ring Size Is Not A Multiple Of STAGING_IMAGE_ALIGNMENT
+            uint64_t headPosition = s_stagingRingHead % STAGING_RING_SIZE;
+            uint64_t position = (headPosition + alignment - 1) / alignment * alignment;
+            uint64_t start = s_stagingRingHead + (position - headPosition);
+
+            // Never Straddle The End Of The Ring
+            if (position + size > STAGING_RING_SIZE)
+            {
+                start = s_stagingRingHead + (STAGING_RING_SIZE - headPosition);
+                position = 0;
+            }
+
+            if (start + size - s_stagingRingTail <= STAGING_RING_SIZE)
+            {
+                s_stagingRingHead = start + size;
+
+                result.buffer = s_stagingRingBuffer;
+                result.offset = position;
+                result.mappedPtr = s_stagingRingMappedPtr + position;
+                return result;
+            }
+
+            // Ring Full, Hand The Recorded Uploads To The GPU And Wait For The Oldest One
+            if (s_pendingUploads.empty())
+            {
+                SubmitUploads();
+            }
+            WaitOldestUpload();
         }
     }
 
-    void CreateSwapChain()
+    vk::CommandBuffer GetUploadCommandBuffer(UploadQueue queue)
     {
-        // Query Swap Chain Info
-        auto getSurfaceCapabilityiesResult = s_physicalDevice.getSurfaceCapabilitiesKHR(s_surface);
-        VK_ASSERT(getSurfaceCapabilityiesResult);
-        s_swapChainSupportDetails.capabilities = getSurfaceCapabilityiesResult.value;
-        auto getSurfaceFormatsResult = s_physicalDevice.getSurfaceFormatsKHR(s_surface);
-        VK_ASSERT(getSurfaceFormatsResult);
-        s_swapChainSupportDetails.formats = getSurfaceFormatsResult.value;
-        auto getSurfacePresentModesResult = s_physicalDevice.getSurfacePresentModesKHR(s_surface);
-        VK_ASSERT(getSurfacePresentModesResult);
-        s_swapChainSupportDetails.presentModes = getSurfacePresentModesResult.value;
-        assert(s_swapChainSupportDetails.IsAdequate());
+        if (s_currentUpload.commandBuffer)
+        {
+            if (s_currentUpload.queue == queue)
+            {
+                return s_currentUpload.commandBuffer;
+            }
 
-        vk::SurfaceFormatKHR surfaceFormat = ChooseSurfaceFormat(s_swapChainSupportDetails.formats);
-        vk::PresentModeKHR presentMode = ChoosePresentMode(s_swapChainSupportDetails.presentModes);
-        vk::Extent2D extent = ChooseSwapExtent(s_swapChainSupportDetails.capabilities);
+            // Switching Queues, The Recorded Work Goes First
+            SubmitUploads();
+        }
 
-        uint32_t imageCount = s_swapChainSupportDetails.capabilities.minImageCount + 1;
-        if (s_swapChainSupportDetails.capabilities.maxImageCount > 0 && imageCount > s_swapChainSupportDetails.capabilities.maxImageCount)
+        uint32_t queueIndex = static_cast<uint32_t>(queue);
+
+        if (!s_freeUploads[queueIndex].empty())
         {
-            imageCount = s_swapChainSupportDetails.capabilities.maxImageCount;
+            s_currentUpload = s_freeUploads[queueIndex].back();
+            s_freeUploads[queueIndex].pop_back();
         }
+        else
+        {
+            vk::CommandBufferAllocateInfo commandBufferAllocateInfo = {};
+            commandBufferAllocateInfo.setLevel(vk::CommandBufferLevel::ePrimary);
+            commandBufferAllocateInfo.setCommandPool(s_uploadCommandPools[queueIndex]);
+            commandBufferAllocateInfo.setCommandBufferCount(1);
 
-        vk::SwapchainCreateInfoKHR createInfo = {};
-        createInfo.setSurface(s_surface);
-        createInfo.setMinImageCount(imageCount);
-        createInfo.setImageFormat(surfaceFormat.format);
-        createInfo.setImageColorSpace(surfaceFormat.colorSpace);
-        createInfo.setImageExtent(extent);
-        createInfo.setImageArrayLayers(1);
-        createInfo.setImageUsage(vk::ImageUsageFlagBits::eColorAttachment);
+            auto allocateCommandBufferResult = s_device.allocateCommandBuffers(commandBufferAllocateInfo);
+            VK_ASSERT(allocateCommandBufferResult);
 
-        uint32_t queueFamilyIndices[] = { s_graphicsFamily, s_presentFamily };
+            auto createFenceResult = s_device.createFence(vk::FenceCreateInfo());
+            VK_ASSERT(createFenceResult);
 
-        if (s_graphicsFamily != s_presentFamily)
+            s_currentUpload = UploadSubmission();
+            s_currentUpload.queue = queue;
+            s_currentUpload.commandBuffer = allocateCommandBufferResult.value[0];
+            s_currentUpload.fence = createFenceResult.value;
+        }
+
+        vk::CommandBufferBeginInfo beginInfo = {};
+        beginInfo.setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit);
+        s_currentUpload.commandBuffer.begin(beginInfo);
+
+        // Chain After The Last Transfer Submission, Graphics Uploads Also Acquire What It Released
+        s_currentUpload.waitSemaphore = s_pendingUploadSemaphore;
+        s_pendingUploadSemaphore = nullptr;
+
+        if (queue == UploadQueue::Graphics)
         {
-            createInfo.setImageSharingMode(vk::SharingMode::eConcurrent);
-            createInfo.setQueueFamilyIndexCount(2);
-            createInfo.setPQueueFamilyIndices(queueFamilyIndices);
+            RecordPendingAcquires(s_currentUpload.commandBuffer);
+        }
+
+        // Earlier Submissions May Still Read Or Write The Destinations
+        vk::MemoryBarrier barrier = {};
+        barrier.setSrcAccessMask(vk::AccessFlagBits::eMemoryWrite);
+        barrier.setDstAccessMask(vk::AccessFlagBits::eTransferWrite);
+        s_currentUpload.commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eAllCommands, vk::PipelineStageFlagBits::eTransfer, {}, barrier, nullptr, nullptr);
+
+        return s_currentUpload.commandBuffer;
+    }
+
+    void RecordBufferOwnershipRelease(vk::CommandBuffer cb, vk::Buffer buffer, vk::DeviceSize offset, vk::DeviceSize size)
+    {
+        vk::BufferMemoryBarrier release = {};
+        release.setSrcAccessMask(vk::AccessFlagBits::eTransferWrite);
+        release.setSrcQueueFamilyIndex(s_transferFamily);
+        release.setDstQueueFamilyIndex(s_graphicsFamily);
+        release.setBuffer(buffer);
+        release.setOffset(offset);
+        release.setSize(size);
+
+        cb.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eBottomOfPipe, {}, nullptr, release, nullptr);
+
+        // Matching Acquire, Recorded On The Graphics Queue Later
+        vk::BufferMemoryBarrier acquire = release;
+        acquire.setSrcAccessMask({});
+        acquire.setDstAccessMask(vk::AccessFlagBits::eMemoryRead);
+        s_pendingAcquireBufferBarriers.push_back(acquire);
+    }
+
+    void RecordImageOwnershipRelease(vk::CommandBuffer cb, vk::Image image, uint32_t layerCount)
+    {
+        vk::ImageSubresourceRange subresourceRange = {};
+        subresourceRange.setAspectMask(vk::ImageAspectFlagBits::eColor);
+        subresourceRange.setBaseMipLevel(0);
+        subresourceRange.setLevelCount(1);
+        subresourceRange.setBaseArrayLayer(0);
+        subresourceRange.setLayerCount(layerCount);
+
+        vk::ImageMemoryBarrier release = {};
+        release.setSrcAccessMask(vk::AccessFlagBits::eTransferWrite);
+        release.setOldLayout(vk::ImageLayout::eTransferDstOptimal);
+        release.setNewLayout(vk::ImageLayout::eShaderReadOnlyOptimal);
+        release.setSrcQueueFamilyIndex(s_transferFamily);
+        release.setDstQueueFamilyIndex(s_graphicsFamily);
+        release.setImage(image);
+        release.setSubresourceRange(subresourceRange);
+
+        cb.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eBottomOfPipe, {}, nullptr, nullptr, release);
+
+        vk::ImageMemoryBarrier acquire = release;
+        acquire.setSrcAccessMask({});
+        acquire.setDstAccessMask(vk::AccessFlagBits::eShaderRead);
+        s_pendingAcquireImageBarriers.push_back(acquire);
+    }
+
+    bool RecordPendingAcquires(vk::CommandBuffer cb)
+    {
+        if (s_pendingAcquireBufferBarriers.empty() && s_pendingAcquireImageBarriers.empty())
+        {
+            return false;
+        }
+
+        cb.pipelineBarrier(vk::PipelineStageFlagBits::eTopOfPipe, vk::PipelineStageFlagBits::eAllCommands, {}, nullptr, s_pendingAcquireBufferBarriers, s_pendingAcquireImageBarriers);
+
+        s_pendingAcquireBufferBarriers.clear();
+        s_pendingAcquireImageBarriers.clear();
+
+        return true;
+    }
+
+    vk::Semaphore AcquireUploadSemaphore()
+    {
+        if (!s_freeUploadSemaphores.empty())
+        {
+            vk::Semaphore semaphore = s_freeUploadSemaphores.back();
+            s_freeUploadSemaphores.pop_back();
+            return semaphore;
         }
-        else
+
+        auto createSemaphoreResult = s_device.createSemaphore(vk::SemaphoreCreateInfo());
+        VK_ASSERT(createSemaphoreResult);
+        return createSemaphoreResult.value;
+    }
+
+    void SubmitPendingAcquires()
+    {
+        if (!s_pendingUploadSemaphore)
         {
-            createInfo.setImageSharingMode(vk::SharingMode::eExclusive);
+            return;
         }
 
-        createInfo.setPreTransform(s_swapChainSupportDetails.capabilities.currentTransform);
-        createInfo.setCompositeAlpha(vk::CompositeAlphaFlagBitsKHR::eOpaque);
-        createInfo.setPresentMode(presentMode);
-        createInfo.setClipped(true);
-        createInfo.setOldSwapchain(nullptr);
+        auto cb = BeginOneTimeCommandBuffer();
+        RecordPendingAcquires(cb);
+        cb.end();
 
-        auto createSwapChainResult = s_device.createSwapchainKHR(createInfo);
-        VK_ASSERT(createSwapChainResult);
-        s_swapChain = createSwapChainResult.value;
+        vk::PipelineStageFlags waitStage = vk::PipelineStageFlagBits::eAllCommands;
 
-        vkGetSwapchainImagesKHR(s_device, s_swapChain, &imageCount, nullptr);
-        s_swapChainImages.resize(imageCount);
-        vkGetSwapchainImagesKHR(s_device, s_swapChain, &imageCount, s_swapChainImages.data());
+        vk::SubmitInfo submitInfo = {};
+        submitInfo.setWaitSemaphoreCount(1);
+        submitInfo.setPWaitSemaphores(&s_pendingUploadSemaphore);
+        submitInfo.setPWaitDstStageMask(&waitStage);
+        submitInfo.setCommandBufferCount(1);
+        submitInfo.setPCommandBuffers(&cb);
 
-        s_swapChainImageFormat = surfaceFormat.format;
-        s_swapChainImageExtent = extent;
+        s_graphicsQueueDefault.submit(submitInfo, nullptr);
+        s_graphicsQueueDefault.waitIdle();
+
+        s_device.freeCommandBuffers(s_commandPoolDefault, cb);
+
+        s_freeUploadSemaphores.push_back(s_pendingUploadSemaphore);
+        s_pendingUploadSemaphore = nullptr;
     }
 
-    void RecreateSwapChain()
+    void SubmitUploads()
     {
-        s_device.waitIdle();
+        if (!s_currentUpload.commandBuffer)
+        {
+            return;
+        }
 
-        /*for (auto framebuffer : s_swapChainFrameBuffers)
+        // Make Transfer Writes Visible To Every Later Submission On The Queue
+        vk::MemoryBarrier barrier = {};
+        barrier.setSrcAccessMask(vk::AccessFlagBits::eTransferWrite);
+        barrier.setDstAccessMask(vk::AccessFlagBits::eMemoryRead);
+        s_currentUpload.commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eAllCommands, {}, barrier, nullptr, nullptr);
+
+        s_currentUpload.commandBuffer.end();
+
+        vk::SubmitInfo submitInfo = {};
+        submitInfo.setCommandBufferCount(1);
+        submitInfo.setPCommandBuffers(&s_currentUpload.commandBuffer);
+
+        vk::PipelineStageFlags waitStage = vk::PipelineStageFlagBits::eAllCommands;
+        if (s_currentUpload.waitSemaphore)
         {
-            vkDestroyFramebuffer(s_device, framebuffer, nullptr);
-        }*/
+            submitInfo.setWaitSemaphoreCount(1);
+            submitInfo.setPWaitSemaphores(&s_currentUpload.waitSemaphore);
+            submitInfo.setPWaitDstStageMask(&waitStage);
+        }
 
-        for (auto imageView : s_swapChainImageViews)
+        vk::Semaphore signalSemaphore = nullptr;
+        vk::Queue queue = s_graphicsQueueDefault;
+        if (s_currentUpload.queue == UploadQueue::Transfer)
         {
-            vkDestroyImageView(s_device, imageView, nullptr);
+            signalSemaphore = AcquireUploadSemaphore();
+            submitInfo.setSignalSemaphoreCount(1);
+            submitInfo.setPSignalSemaphores(&signalSemaphore);
+            queue = s_transferQueueDefault;
         }
 
-        vkDestroySwapchainKHR(s_device, s_swapChain, nullptr);
+        auto submitResult = queue.submit(submitInfo, s_currentUpload.fence);
+        assert(submitResult == vk::Result::eSuccess);
 
-        // s_swapChainFrameBuffers.clear();
-        s_swapChainImageViews.clear();
-        s_swapChainImages.clear();
+        if (signalSemaphore)
+        {
+            s_pendingUploadSemaphore = signalSemaphore;
+        }
 
-        // s_device.destroyImageView(s_depthImageView);
-       /* s_device.destroyImage(s_depthImage);
-        s_device.freeMemory(s_depthImageMemory);*/
+        s_currentUpload.ringEnd = s_stagingRingHead;
+        s_currentUpload.serial = ++s_uploadSubmittedSerial;
+        s_pendingUploads.push_back(s_currentUpload);
+        s_currentUpload = UploadSubmission();
+    }
 
-        CreateSwapChain();
-        CreateImageViews();
-        // CreateDepthImage();
-        // CreateSwapChainFramebuffers();
+    void FinishUpload()
+    {
+        if (s_uploadBatchDepth == 0)
+        {
+            SubmitUploads();
+        }
     }
 
-  /*  void CreateSwapChainFramebuffers()
+    void RetireUploads()
     {
-        s_swapChainFrameBuffers.resize(s_swapChainImageViews.size());
-        for (size_t i = 0; i < s_swapChainImageViews.size(); i++)
+        while (!s_pendingUploads.empty())
         {
-            std::vector<VkImageView> attachments = { s_swapChainImageViews[i], s_depthImageView };
+            UploadSubmission& upload = s_pendingUploads.front();
+            if (s_device.getFenceStatus(upload.fence) != vk::Result::eSuccess)
+            {
+                break;
+            }
 
-            VkFramebufferCreateInfo framebufferInfo = {};
-            framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-            framebufferInfo.renderPass = s_renderPassDefault;
-            framebufferInfo.attachmentCount = attachments.size();
-            framebufferInfo.pAttachments = attachments.data();
-            framebufferInfo.width = s_swapChainImageExtent.width;
-            framebufferInfo.height = s_swapChainImageExtent.height;
-            framebufferInfo.layers = 1;
+            s_stagingRingTail = upload.ringEnd;
+            s_uploadCompletedSerial = upload.serial;
 
-            auto result = vkCreateFramebuffer(s_device, &framebufferInfo, nullptr, &s_swapChainFrameBuffers[i]);
-            assert(result == VK_SUCCESS);
+            for (size_t i = 0; i < upload.oversizedBuffers.size(); i++)
+            {
+                vmaUnmapMemory(s_allocator, upload.oversizedAllocations[i]);
+                DestroyVulkanBuffer(upload.oversizedBuffers[i], upload.oversizedAllocations[i]);
+            }
+            upload.oversizedBuffers.clear();
+            upload.oversizedAllocations.clear();
+
+            if (upload.waitSemaphore)
+            {
+                s_freeUploadSemaphores.push_back(upload.waitSemaphore);
+                upload.waitSemaphore = nullptr;
+            }
+
+            s_device.resetFences(upload.fence);
+            upload.commandBuffer.reset({});
+
+            s_freeUploads[static_cast<uint32_t>(upload.queue)].push_back(upload);
+            s_pendingUploads.pop_front();
         }
-    }*/
+    }
 
-    void CreateCommandPoolDefault()
+    void WaitOldestUpload()
     {
-        vk::CommandPoolCreateInfo commandPoolCreateInfo = {};
-        commandPoolCreateInfo.setQueueFamilyIndex(s_graphicsFamily);
-        commandPoolCreateInfo.setFlags(vk::CommandPoolCreateFlagBits::eResetCommandBuffer);
-        auto createCommandPoolResult = s_device.createCommandPool(commandPoolCreateInfo);
-        VK_ASSERT(createCommandPoolResult);
+        if (s_pendingUploads.empty())
+        {
+            return;
+        }
 
-        s_commandPoolDefault = createCommandPoolResult.value;
+        s_device.waitForFences(s_pendingUploads.front().fence, true, UINT64_MAX);
+        RetireUploads();
     }
 
-    void CreateCommandBuffersDefault()
+    void CreateTransientUniformResources()
     {
-        vk::CommandBufferAllocateInfo commandBufferAllocateInfo = {};
-        commandBufferAllocateInfo.setCommandBufferCount(s_swapChainImages.size());
-        commandBufferAllocateInfo.setCommandPool(s_commandPoolDefault);
-        commandBufferAllocateInfo.setLevel(vk::CommandBufferLevel::ePrimary);
+        CreateVulkanBuffer(
+            TRANSIENT_UNIFORM_REGION_SIZE * MAX_FRAMES_IN_FLIGHT,
+            vk::BufferUsageFlagBits::eUniformBuffer,
+            vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent,
+            MemoryPool::DynamicUniform,
+            s_transientUniformBuffer,
+            s_transientUniformAllocation);
+
+        void* mappedData = nullptr;
+        VkResult mapResult = vmaMapMemory(s_allocator, s_transientUniformAllocation, &mappedData);
+        assert(mapResult == VK_SUCCESS);
+        s_transientUniformMappedPtr = static_cast<uint8_t*>(mappedData);
+        s_transientUniformHead = 0;
+    }
 
-        auto allocateCommandBuffersResult = s_device.allocateCommandBuffers(commandBufferAllocateInfo);
-        VK_ASSERT(allocateCommandBuffersResult);
-        s_commandBuffersDefault = allocateCommandBuffersResult.value;
+    void DestroyTransientUniformResources()
+    {
+        vmaUnmapMemory(s_allocator, s_transientUniformAllocation);
+        DestroyVulkanBuffer(s_transientUniformBuffer, s_transientUniformAllocation);
+        s_transientUniformMappedPtr = nullptr;
     }
 
-    void CreateDescriptorPoolDefault()
+    void CreateBindlessResources()
     {
-        vk::DescriptorPoolSize uniformmBufferPoolSize = {};
-        uniformmBufferPoolSize.setType(vk::DescriptorType::eUniformBuffer);
-        uniformmBufferPoolSize.setDescriptorCount(500);
+        vk::DescriptorSetLayoutBinding imageBinding = {};
+        imageBinding.setBinding(0);
+        imageBinding.setDescriptorType(vk::DescriptorType::eSampledImage);
+        imageBinding.setDescriptorCount(BINDLESS_IMAGE_CAPACITY);
+        imageBinding.setStageFlags(vk::ShaderStageFlagBits::eAll);
 
-        vk::DescriptorPoolSize texturePoolSize = {};
-        texturePoolSize.setType(vk::DescriptorType::eSampledImage);
-        texturePoolSize.setDescriptorCount(200);
+        vk::DescriptorSetLayoutBinding samplerBinding = {};
+        samplerBinding.setBinding(1);
+        samplerBinding.setDescriptorType(vk::DescriptorType::eSampler);
+        samplerBinding.setDescriptorCount(BINDLESS_SAMPLER_CAPACITY);
+        samplerBinding.setStageFlags(vk::ShaderStageFlagBits::eAll);
 
-        vk::DescriptorPoolSize inputAttachmentPoolSize = {};
-        inputAttachmentPoolSize.setType(vk::DescriptorType::eInputAttachment);
-        inputAttachmentPoolSize.setDescriptorCount(30);
+        std::vector<vk::DescriptorSetLayoutBinding> bindings = { imageBinding, samplerBinding };
 
-        vk::DescriptorPoolSize combinedImageSamplerPoolSize = {};
-        combinedImageSamplerPoolSize.setType(vk::DescriptorType::eCombinedImageSampler);
-        combinedImageSamplerPoolSize.setDescriptorCount(200);
+        // Unused Slots Stay Unwritten, New Resources Are Written While Frames Are In Flight
+        vk::DescriptorBindingFlags bindingFlag = vk::DescriptorBindingFlagBits::eUpdateAfterBind | vk::DescriptorBindingFlagBits::ePartiallyBound | vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending;
+        std::vector<vk::DescriptorBindingFlags> bindingFlags = { bindingFlag, bindingFlag };
 
-        std::vector<vk::DescriptorPoolSize> sizes;
-        sizes.push_back(uniformmBufferPoolSize);
-        sizes.push_back(texturePoolSize);
-        sizes.push_back(inputAttachmentPoolSize);
-        sizes.push_back(combinedImageSamplerPoolSize);
+        vk::DescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsCreateInfo = {};
+        bindingFlagsCreateInfo.setBindingCount(bindingFlags.size());
+        bindingFlagsCreateInfo.setPBindingFlags(bindingFlags.data());
+
+        vk::DescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo = {};
+        descriptorSetLayoutCreateInfo.setFlags(vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool);
+        descriptorSetLayoutCreateInfo.setBindingCount(bindings.size());
+        descriptorSetLayoutCreateInfo.setPBindings(bindings.data());
+        descriptorSetLayoutCreateInfo.setPNext(&bindingFlagsCreateInfo);
+
+        auto createDescriptorSetLayoutResult = s_device.createDescriptorSetLayout(descriptorSetLayoutCreateInfo);
+        VK_ASSERT(createDescriptorSetLayoutResult);
+        s_bindlessDescriptorSetLayout = createDescriptorSetLayoutResult.value;
+
+        vk::DescriptorPoolSize imagePoolSize = {};
+        imagePoolSize.setType(vk::DescriptorType::eSampledImage);
+        imagePoolSize.setDescriptorCount(BINDLESS_IMAGE_CAPACITY);
+
+        vk::DescriptorPoolSize samplerPoolSize = {};
+        samplerPoolSize.setType(vk::DescriptorType::eSampler);
+        samplerPoolSize.setDescriptorCount(BINDLESS_SAMPLER_CAPACITY);
+
+        std::vector<vk::DescriptorPoolSize> sizes = { imagePoolSize, samplerPoolSize };
 
         vk::DescriptorPoolCreateInfo poolCreateInfo = {};
         poolCreateInfo.setPoolSizeCount(sizes.size());
         poolCreateInfo.setPPoolSizes(sizes.data());
-        poolCreateInfo.setMaxSets(1000);
-        poolCreateInfo.setFlags(vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet);
+        poolCreateInfo.setMaxSets(1);
+        poolCreateInfo.setFlags(vk::DescriptorPoolCreateFlagBits::eUpdateAfterBind);
 
         auto createDescriptorPoolResult = s_device.createDescriptorPool(poolCreateInfo);
         VK_ASSERT(createDescriptorPoolResult);
-        s_descriptorPoolDefault = createDescriptorPoolResult.value;
+        s_bindlessDescriptorPool = createDescriptorPoolResult.value;
+
+        vk::DescriptorSetAllocateInfo descriptorSetAllocateInfo = {};
+        descriptorSetAllocateInfo.setDescriptorPool(s_bindlessDescriptorPool);
+        descriptorSetAllocateInfo.setDescriptorSetCount(1);
+        descriptorSetAllocateInfo.setPSetLayouts(&s_bindlessDescriptorSetLayout);
+
+        auto allocateDescriptorSetsResult = s_device.allocateDescriptorSets(descriptorSetAllocateInfo);
+        VK_ASSERT(allocateDescriptorSetsResult);
+        s_bindlessDescriptorSet = allocateDescriptorSetsResult.value[0];
+
+        // Exposed As A Regular Uniform Layout, So Pipelines Can Place It At Any Set
+        s_bindlessUniformLayout.id = s_uniformLayoutHandlePool.Allocate(s_bindlessDescriptorSetLayout);
+        s_uniformLayoutHandlePool.FetchResource(s_bindlessUniformLayout.id)->handle = s_bindlessUniformLayout.id;
     }
 
-    void CreateSyncObjects()
-    {        
-        s_imageAvailableSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
-        s_renderFinishedSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
-        s_inFlightFences.resize(MAX_FRAMES_IN_FLIGHT);
+    void DestroyBindlessResources()
+    {
+        s_uniformLayoutHandlePool.FreeHandle(s_bindlessUniformLayout.id);
+        s_bindlessUniformLayout = UniformLayout();
 
-        vk::SemaphoreCreateInfo semaphoreCreateInfo = {};
-        vk::FenceCreateInfo fenceCreateInfo = {};
-        fenceCreateInfo.setFlags(vk::FenceCreateFlagBits::eSignaled);
+        s_device.destroyDescriptorPool(s_bindlessDescriptorPool);
+        s_device.destroyDescriptorSetLayout(s_bindlessDescriptorSetLayout);
 
-        for (int i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
+        s_bindlessDescriptorPool = nullptr;
+        s_bindlessDescriptorSetLayout = nullptr;
+        s_bindlessDescriptorSet = nullptr;
+    }
+
+    uint32_t AllocateBindlessIndex(uint32_t& count, std::vector<uint32_t>& freeIndices, uint32_t capacity)
+    {
+        if (!freeIndices.empty())
         {
-            auto imageAvailableSemaphoreCreateResult = s_device.createSemaphore(semaphoreCreateInfo);
-            VK_ASSERT(imageAvailableSemaphoreCreateResult);
-            s_imageAvailableSemaphores[i] = imageAvailableSemaphoreCreateResult.value;
+            uint32_t index = freeIndices.back();
+            freeIndices.pop_back();
+            return index;
+        }
 
-            auto renderFinishedSemaphoreCreateResult = s_device.createSemaphore(semaphoreCreateInfo);
-            VK_ASSERT(renderFinishedSemaphoreCreateResult);
-            s_renderFinishedSemaphores[i] = renderFinishedSemaphoreCreateResult.value;
+        assert(count < capacity);
+        return count++;
+    }
 
-            auto createInFlightFenceResult = s_device.createFence(fenceCreateInfo);
-            VK_ASSERT(createInFlightFenceResult);
-            s_inFlightFences[i] = createInFlightFenceResult.value;
-        }
+    void WriteBindlessImage(uint32_t index, vk::ImageView imageView, vk::ImageLayout layout)
+    {
+        vk::DescriptorImageInfo imageInfo = {};
+        imageInfo.setImageLayout(layout);
+        imageInfo.setImageView(imageView);
+
+        vk::WriteDescriptorSet writeDescriptorSet = {};
+        writeDescriptorSet.setDescriptorCount(1);
+        writeDescriptorSet.setPImageInfo(&imageInfo);
+        writeDescriptorSet.setDstBinding(0);
+        writeDescriptorSet.setDstArrayElement(index);
+        writeDescriptorSet.setDstSet(s_bindlessDescriptorSet);
+        writeDescriptorSet.setDescriptorType(vk::DescriptorType::eSampledImage);
+
+        s_device.updateDescriptorSets(writeDescriptorSet, nullptr);
+    }
+
+    void WriteBindlessSampler(uint32_t index, vk::Sampler sampler)
+    {
+        vk::DescriptorImageInfo imageInfo = {};
+        imageInfo.setSampler(sampler);
+
+        vk::WriteDescriptorSet writeDescriptorSet = {};
+        writeDescriptorSet.setDescriptorCount(1);
+        writeDescriptorSet.setPImageInfo(&imageInfo);
+        writeDescriptorSet.setDstBinding(1);
+        writeDescriptorSet.setDstArrayElement(index);
+        writeDescriptorSet.setDstSet(s_bindlessDescriptorSet);
+        writeDescriptorSet.setDescriptorType(vk::DescriptorType::eSampler);
+
+        s_device.updateDescriptorSets(writeDescriptorSet, nullptr);
     }
 
     vk::CommandBuffer BeginOneTimeCommandBuffer()
@@ -2552,6 +5349,18 @@ namespace GFX
             return vk::Format::eR32G32B32Sfloat;
         case ValueType::UInt16:
             return vk::Format::eR16Uint;
+        case ValueType::Float16x2:
+            return vk::Format::eR16G16Sfloat;
+        case ValueType::Float16x4:
+            return vk::Format::eR16G16B16A16Sfloat;
+        case ValueType::SNorm8x4:
+            return vk::Format::eR8G8B8A8Snorm;
+        case ValueType::SNorm16x2:
+            return vk::Format::eR16G16Snorm;
+        case ValueType::UNorm8x4:
+            return vk::Format::eR8G8B8A8Unorm;
+        case ValueType::A2B10G10R10SNorm:
+            return vk::Format::eA2B10G10R10SnormPack32;
         }
     }
 
@@ -2566,6 +5375,79 @@ namespace GFX
         }
     }
 
+    vk::SubpassContents MapSubpassContentsForVulkan(SubpassContents contents)
+    {
+        switch (contents)
+        {
+        case SubpassContents::Inline:
+            return vk::SubpassContents::eInline;
+        case SubpassContents::SecondaryCommandBuffers:
+            return vk::SubpassContents::eSecondaryCommandBuffers;
+        }
+    }
+
+    vk::AccessFlags MapAcessForVulkan(const Access& access)
+    {
+        switch (access)
+        {
+        case Access::ColorAttachmentWrite:
+            return vk::AccessFlagBits::eColorAttachmentWrite;
+        case Access::ShaderRead:
+            return vk::AccessFlagBits::eShaderRead;
+        case Access::InputAttachmentRead:
+            return vk::AccessFlagBits::eInputAttachmentRead;
+        case Access::DepthStencilAttachmentWrite:
+            return vk::AccessFlagBits::eDepthStencilAttachmentWrite;
+        case Access::ShaderWrite:
+            return vk::AccessFlagBits::eShaderWrite;
+        case Access::ShaderReadWrite:
+            return vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite;
+        case Access::IndirectCommandRead:
+            return vk::AccessFlagBits::eIndirectCommandRead;
+        case Access::VertexAttributeRead:
+            return vk::AccessFlagBits::eVertexAttributeRead;
+        case Access::IndexRead:
+            return vk::AccessFlagBits::eIndexRead;
+        case Access::TransferRead:
+            return vk::AccessFlagBits::eTransferRead;
+        case Access::TransferWrite:
+            return vk::AccessFlagBits::eTransferWrite;
+        default:
+            assert(false);
+            return vk::AccessFlagBits::eShaderRead;
+        }
+    }
+
+    vk::PipelineStageFlags MapPipelineStageForVulkan(const PipelineStage& pipelineStage)
+    {
+        switch (pipelineStage)
+        {
+        case PipelineStage::ColorAttachmentOutput:
+            return vk::PipelineStageFlagBits::eColorAttachmentOutput;
+        case PipelineStage::FragmentShader:
+            return vk::PipelineStageFlagBits::eFragmentShader;
+        case PipelineStage::VertexShader:
+            return vk::PipelineStageFlagBits::eVertexShader;
+        case PipelineStage::EarlyFragmentTests:
+            return vk::PipelineStageFlagBits::eEarlyFragmentTests;
+        case PipelineStage::LateFragmentTests:
+            return vk::PipelineStageFlagBits::eLateFragmentTests;
+        case PipelineStage::All:
+            return vk::PipelineStageFlagBits::eAllCommands;
+        case PipelineStage::ComputeShader:
+            return vk::PipelineStageFlagBits::eComputeShader;
+        case PipelineStage::DrawIndirect:
+            return vk::PipelineStageFlagBits::eDrawIndirect;
+        case PipelineStage::VertexInput:
+            return vk::PipelineStageFlagBits::eVertexInput;
+        case PipelineStage::Transfer:
+            return vk::PipelineStageFlagBits::eTransfer;
+        default:
+            assert(false);
+            return vk::PipelineStageFlagBits::eAllCommands;
+        }
+    }
+
     vk::ShaderStageFlags MapShaderStageForVulkan(const ShaderStage& stage)
     {
         switch (stage)
@@ -2624,10 +5506,16 @@ namespace GFX
         {
         case UniformType::UniformBuffer:
             return vk::DescriptorType::eUniformBuffer;
+        case UniformType::DynamicUniformBuffer:
+            return vk::DescriptorType::eUniformBufferDynamic;
         case UniformType::SampledImage:
             return vk::DescriptorType::eCombinedImageSampler;
         case UniformType::InputAttachment:
             return vk::DescriptorType::eInputAttachment;
+        case UniformType::StorageBuffer:
+            return vk::DescriptorType::eStorageBuffer;
+        case UniformType::StorageImage:
+            return vk::DescriptorType::eStorageImage;
         }
     }
 
@@ -2807,7 +5695,157 @@ namespace GFX
         return format == vk::Format::eD32SfloatS8Uint || format == vk::Format::eD24UnormS8Uint || format ==  vk::Format::eD16UnormS8Uint;
     }
 
-    void CreateVulkanBuffer(size_t size, vk::BufferUsageFlags usage, vk::MemoryPropertyFlags properties, vk::Buffer& buffer, vk::DeviceMemory& bufferMemory)
+    void CreateMemoryPools()
+    {
+        VmaAllocatorCreateInfo allocatorCreateInfo = {};
+        allocatorCreateInfo.instance = s_instance;
+        allocatorCreateInfo.physicalDevice = s_physicalDevice;
+        allocatorCreateInfo.device = s_device;
+        // VMA 2.3 Supports Up To Vulkan 1.1
+        allocatorCreateInfo.vulkanApiVersion = VK_API_VERSION_1_1;
+
+        VkResult createAllocatorResult = vmaCreateAllocator(&allocatorCreateInfo, &s_allocator);
+        assert(createAllocatorResult == VK_SUCCESS);
+
+        // Representative Resources, Used To Pick One Memory Type Per Pool
+        vk::BufferCreateInfo bufferCreateInfos[MEMORY_POOL_COUNT] = {};
+        bufferCreateInfos[static_cast<uint32_t>(MemoryPool::StaticGeometry)].setUsage(vk::BufferUsageFlagBits::eVertexBuffer | vk::BufferUsageFlagBits::eIndexBuffer | vk::BufferUsageFlagBits::eUniformBuffer | vk::BufferUsageFlagBits::eTransferDst);
+        bufferCreateInfos[static_cast<uint32_t>(MemoryPool::DynamicUniform)].setUsage(vk::BufferUsageFlagBits::eVertexBuffer | vk::BufferUsageFlagBits::eIndexBuffer | vk::BufferUsageFlagBits::eUniformBuffer);
+        bufferCreateInfos[static_cast<uint32_t>(MemoryPool::Staging)].setUsage(vk::BufferUsageFlagBits::eTransferSrc);
+
+        vk::ImageCreateInfo renderTargetCreateInfo = {};
+        renderTargetCreateInfo.setImageType(vk::ImageType::e2D);
+        renderTargetCreateInfo.setExtent({ 1024, 1024, 1 });
+        renderTargetCreateInfo.setMipLevels(1);
+        renderTargetCreateInfo.setArrayLayers(1);
+        renderTargetCreateInfo.setFormat(vk::Format::eR8G8B8A8Unorm);
+        renderTargetCreateInfo.setTiling(vk::ImageTiling::eOptimal);
+        renderTargetCreateInfo.setUsage(vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eInputAttachment | vk::ImageUsageFlagBits::eSampled);
+        renderTargetCreateInfo.setSamples(vk::SampleCountFlagBits::e1);
+
+        for (uint32_t i = 0; i < MEMORY_POOL_COUNT; i++)
+        {
+            MemoryPool pool = static_cast<MemoryPool>(i);
+
+            VmaAllocationCreateInfo allocCreateInfo = {};
+            allocCreateInfo.usage = MapMemoryPoolUsageForVma(pool);
+            allocCreateInfo.requiredFlags = static_cast<VkMemoryPropertyFlags>(MapMemoryPoolPropertiesForVulkan(pool));
+
+            VkResult findMemoryTypeResult;
+            if (pool == MemoryPool::RenderTarget)
+            {
+                findMemoryTypeResult = vmaFindMemoryTypeIndexForImageInfo(s_allocator, reinterpret_cast<const VkImageCreateInfo*>(&renderTargetCreateInfo), &allocCreateInfo, &s_memoryPoolTypeIndices[i]);
+            }
+            else
+            {
+                bufferCreateInfos[i].setSize(65536);
+                bufferCreateInfos[i].setSharingMode(vk::SharingMode::eExclusive);
+                findMemoryTypeResult = vmaFindMemoryTypeIndexForBufferInfo(s_allocator, reinterpret_cast<const VkBufferCreateInfo*>(&bufferCreateInfos[i]), &allocCreateInfo, &s_memoryPoolTypeIndices[i]);
+            }
+            assert(findMemoryTypeResult == VK_SUCCESS);
+
+            VmaPoolCreateInfo poolCreateInfo = {};
+            poolCreateInfo.memoryTypeIndex = s_memoryPoolTypeIndices[i];
+            poolCreateInfo.blockSize = s_memoryPoolBlockSizes[i];
+
+            VkResult createPoolResult = vmaCreatePool(s_allocator, &poolCreateInfo, &s_memoryPools[i]);
+            assert(createPoolResult == VK_SUCCESS);
+        }
+    }
+
+    void DestroyMemoryPools()
+    {
+        VmaStats stats = {};
+        vmaCalculateStats(s_allocator, &stats);
+
+        // Destroying Pools With Live Allocations Asserts Inside VMA, Leave Them To The Driver
+        if (stats.total.allocationCount > 0)
+        {
+            printf("GFX: %u allocations still alive at shutdown \n", stats.total.allocationCount);
+            return;
+        }
+
+        for (uint32_t i = 0; i < MEMORY_POOL_COUNT; i++)
+        {
+            vmaDestroyPool(s_allocator, s_memoryPools[i]);
+            s_memoryPools[i] = nullptr;
+        }
+
+        vmaDestroyAllocator(s_allocator);
+        s_allocator = nullptr;
+    }
+
+    VmaMemoryUsage MapMemoryPoolUsageForVma(MemoryPool pool)
+    {
+        switch (pool)
+        {
+        case MemoryPool::StaticGeometry:
+            return VMA_MEMORY_USAGE_GPU_ONLY;
+        case MemoryPool::DynamicUniform:
+            return VMA_MEMORY_USAGE_CPU_TO_GPU;
+        case MemoryPool::Staging:
+            return VMA_MEMORY_USAGE_CPU_ONLY;
+        case MemoryPool::RenderTarget:
+            return VMA_MEMORY_USAGE_GPU_ONLY;
+        default:
+            assert(false);
+            return VMA_MEMORY_USAGE_UNKNOWN;
+        }
+    }
+
+    vk::MemoryPropertyFlags MapMemoryPoolPropertiesForVulkan(MemoryPool pool)
+    {
+        switch (pool)
+        {
+        case MemoryPool::StaticGeometry:
+            return vk::MemoryPropertyFlagBits::eDeviceLocal;
+        case MemoryPool::DynamicUniform:
+            return vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
+        case MemoryPool::Staging:
+            return vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
+        case MemoryPool::RenderTarget:
+            return vk::MemoryPropertyFlagBits::eDeviceLocal;
+        default:
+            assert(false);
+            return {};
+        }
+    }
+
+    VmaAllocationCreateInfo MakeAllocationCreateInfo(MemoryPool pool, const vk::MemoryRequirements& memRequirements, vk::MemoryPropertyFlags properties)
+    {
+        VmaAllocationCreateInfo allocCreateInfo = {};
+
+        if (pool != MemoryPool::Default)
+        {
+            uint32_t poolIndex = static_cast<uint32_t>(pool);
+            uint32_t memoryTypeIndex = s_memoryPoolTypeIndices[poolIndex];
+            vk::MemoryPropertyFlags memoryTypeProperties = s_physicalDeviceMemoryProperties.memoryTypes[memoryTypeIndex].propertyFlags;
+
+            bool compatible = (memRequirements.memoryTypeBits & (1u << memoryTypeIndex)) != 0 && (memoryTypeProperties & properties) == properties;
+            // Large Resources Would Waste Most Of A Block, Let VMA Give Them Dedicated Memory Instead
+            bool fits = memRequirements.size <= s_memoryPoolBlockSizes[poolIndex] / 2;
+
+            if (compatible && fits)
+            {
+                allocCreateInfo.pool = s_memoryPools[poolIndex];
+                return allocCreateInfo;
+            }
+        }
+
+        if (properties & vk::MemoryPropertyFlagBits::eHostVisible)
+        {
+            allocCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
+        }
+        else
+        {
+            allocCreateInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
+        }
+        allocCreateInfo.requiredFlags = static_cast<VkMemoryPropertyFlags>(properties);
+
+        return allocCreateInfo;
+    }
+
+    void CreateVulkanBuffer(size_t size, vk::BufferUsageFlags usage, vk::MemoryPropertyFlags properties, MemoryPool pool, vk::Buffer& buffer, VmaAllocation& allocation)
     {
         vk::BufferCreateInfo bufferCreateInfo = {};
         bufferCreateInfo.setSize(size);
@@ -2819,22 +5857,61 @@ namespace GFX
         buffer = createBufferResult.value;
 
         vk::MemoryRequirements memRequirements = s_device.getBufferMemoryRequirements(buffer);
+        VmaAllocationCreateInfo allocCreateInfo = MakeAllocationCreateInfo(pool, memRequirements, properties);
+
+        VkResult allocResult = vmaAllocateMemoryForBuffer(s_allocator, buffer, &allocCreateInfo, &allocation, nullptr);
+        assert(allocResult == VK_SUCCESS);
+
+        VkResult bindResult = vmaBindBufferMemory(s_allocator, allocation, buffer);
+        assert(bindResult == VK_SUCCESS);
+    }
+
+    void DestroyVulkanBuffer(vk::Buffer buffer, VmaAllocation allocation)
+    {
+        s_device.destroyBuffer(buffer);
+        vmaFreeMemory(s_allocator, allocation);
+    }
+
+    void CreateVulkanBufferWithDeviceAddress(size_t size, vk::BufferUsageFlags usage, vk::MemoryPropertyFlags properties, vk::Buffer& buffer, vk::DeviceMemory& deviceMemory)
+    {
+        assert(s_bufferDeviceAddressEnabled);
+
+        vk::BufferCreateInfo bufferCreateInfo = {};
+        bufferCreateInfo.setSize(size);
+        bufferCreateInfo.setUsage(usage | vk::BufferUsageFlagBits::eShaderDeviceAddress);
+        bufferCreateInfo.setSharingMode(vk::SharingMode::eExclusive);
+
+        auto createBufferResult = s_device.createBuffer(bufferCreateInfo);
+        VK_ASSERT(createBufferResult);
+        buffer = createBufferResult.value;
+
+        vk::MemoryRequirements memRequirements = s_device.getBufferMemoryRequirements(buffer);
+
+        // Dedicated Allocation, The Vendored VMA Has No Way To Pass The Device Address Flag
+        vk::MemoryAllocateFlagsInfo allocateFlagsInfo = {};
+        allocateFlagsInfo.setFlags(vk::MemoryAllocateFlagBits::eDeviceAddress);
 
-        vk::MemoryAllocateInfo allocInfo = {};
-        allocInfo.setAllocationSize(memRequirements.size);
-        allocInfo.setMemoryTypeIndex(FindMemoryType(memRequirements.memoryTypeBits, properties));
+        vk::MemoryAllocateInfo allocateInfo = {};
+        allocateInfo.setPNext(&allocateFlagsInfo);
+        allocateInfo.setAllocationSize(memRequirements.size);
+        allocateInfo.setMemoryTypeIndex(FindMemoryType(memRequirements.memoryTypeBits, properties));
 
-        auto allocResult = s_device.allocateMemory(allocInfo);
-        VK_ASSERT(allocResult);
-        bufferMemory = allocResult.value;
+        auto allocateMemoryResult = s_device.allocateMemory(allocateInfo);
+        VK_ASSERT(allocateMemoryResult);
+        deviceMemory = allocateMemoryResult.value;
 
-        s_device.bindBufferMemory(buffer, bufferMemory, 0);
+        s_device.bindBufferMemory(buffer, deviceMemory, 0);
     }
 
     void TransitionImageLayout(vk::Image img, vk::Format format, vk::ImageLayout oldLayout, vk::ImageLayout newLayout, uint32_t layerCount)
     {
         auto cb = BeginOneTimeCommandBuffer();
+        RecordImageLayoutTransition(cb, img, format, oldLayout, newLayout, layerCount);
+        EndOneTimeCommandBuffer(cb);
+    }
 
+    void RecordImageLayoutTransition(vk::CommandBuffer cb, vk::Image img, vk::Format format, vk::ImageLayout oldLayout, vk::ImageLayout newLayout, uint32_t layerCount)
+    {
         vk::ImageMemoryBarrier barrier = {};
         barrier.setOldLayout(oldLayout);
         barrier.setNewLayout(newLayout);
@@ -2898,6 +5975,14 @@ namespace GFX
             sourceStage = vk::PipelineStageFlagBits::eFragmentShader;
             destinationStage = vk::PipelineStageFlagBits::eColorAttachmentOutput;
         }
+        else if (oldLayout == vk::ImageLayout::eUndefined && newLayout == vk::ImageLayout::eGeneral)
+        {
+            barrier.setSrcAccessMask({});
+            barrier.setDstAccessMask(vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite);
+
+            sourceStage = vk::PipelineStageFlagBits::eTopOfPipe;
+            destinationStage = vk::PipelineStageFlagBits::eAllCommands;
+        }
         else if (oldLayout == vk::ImageLayout::eUndefined && newLayout == vk::ImageLayout::eDepthStencilAttachmentOptimal)
         {
             barrier.setSrcAccessMask({});
@@ -2912,16 +5997,12 @@ namespace GFX
         }
 
         cb.pipelineBarrier(sourceStage, destinationStage, {}, nullptr, nullptr, barrier);
-
-        EndOneTimeCommandBuffer(cb);
     }
 
-    void CopyBufferToImage(vk::Buffer buffer, vk::Image img, uint32_t width, uint32_t height, uint32_t layerCount)
+    void RecordCopyBufferToImage(vk::CommandBuffer cb, vk::Buffer buffer, vk::DeviceSize bufferOffset, vk::Image img, uint32_t width, uint32_t height, uint32_t layerCount)
     {
-        auto cb = BeginOneTimeCommandBuffer();
-
         vk::BufferImageCopy bufferImageCopy = {};
-        bufferImageCopy.setBufferOffset(0);
+        bufferImageCopy.setBufferOffset(bufferOffset);
         bufferImageCopy.setBufferImageHeight(0);
         bufferImageCopy.setBufferRowLength(0);
 
@@ -2936,8 +6017,6 @@ namespace GFX
         bufferImageCopy.setImageSubresource(subresourceLayer);
 
         cb.copyBufferToImage(buffer, img, vk::ImageLayout::eTransferDstOptimal, bufferImageCopy);
-
-        EndOneTimeCommandBuffer(cb);
     }
 
     void CreateVulkanImage(uint32_t width, uint32_t height, 
@@ -2945,8 +6024,9 @@ namespace GFX
         vk::ImageTiling tiling, 
         vk::ImageUsageFlags usage, 
         vk::MemoryPropertyFlags properties, 
+        MemoryPool pool,
         vk::Image& image, 
-        vk::DeviceMemory& imageMemory)
+        VmaAllocation& allocation)
     {
         vk::ImageCreateInfo imageInfo = {};
         imageInfo.setImageType(vk::ImageType::e2D);
@@ -2965,16 +6045,19 @@ namespace GFX
         image = createImageResult.value;
 
         vk::MemoryRequirements memReq = s_device.getImageMemoryRequirements(image);
+        VmaAllocationCreateInfo allocCreateInfo = MakeAllocationCreateInfo(pool, memReq, properties);
 
-        vk::MemoryAllocateInfo memAllocInfo = {};
-        memAllocInfo.setAllocationSize(memReq.size);
-        memAllocInfo.setMemoryTypeIndex(FindMemoryType(memReq.memoryTypeBits, properties));
+        VkResult allocResult = vmaAllocateMemoryForImage(s_allocator, image, &allocCreateInfo, &allocation, nullptr);
+        assert(allocResult == VK_SUCCESS);
 
-        auto allocateMemoryResult = s_device.allocateMemory(memAllocInfo);
-        VK_ASSERT(allocateMemoryResult);
-        imageMemory = allocateMemoryResult.value;
+        VkResult bindResult = vmaBindImageMemory(s_allocator, allocation, image);
+        assert(bindResult == VK_SUCCESS);
+    }
 
-        s_device.bindImageMemory(image, imageMemory, 0);
+    void DestroyVulkanImage(vk::Image image, VmaAllocation allocation)
+    {
+        s_device.destroyImage(image);
+        vmaFreeMemory(s_allocator, allocation);
     }
 
     vk::ImageView CreateVulkanImageView(vk::Image image, vk::Format format, vk::ImageAspectFlags aspect, vk::ImageViewType type, uint32_t layerCount, uint32_t levelCount) 